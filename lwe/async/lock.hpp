@@ -37,6 +37,25 @@ public:
     int                          locked; //!< lock counter
 };
 
+//! @brief reader-writer spin lock, writer preferred, not reentrant
+//! @note  satisfies SharedMutex, use LOCKGUARD / SHAREDGUARD
+class SharedLock {
+    static constexpr uint32_t WRITER = 1u << 31; //!< writer bit, low bits: reader count
+    static constexpr int      SPIN   = 64;       //!< pause count before yield
+
+public:
+    void lock() noexcept;          //!< exclusive
+    void unlock() noexcept;        //!< exclusive
+    void lock_shared() noexcept;   //!< shared
+    void unlock_shared() noexcept; //!< shared
+
+private:
+    static void wait(int&) noexcept; //!< pause, yield after spin
+
+private:
+    std::atomic<uint32_t> state = 0;
+};
+
 } // namespace async
 LWE_END
 
@@ -97,5 +97,62 @@ void Lock::unlock() {
     }
 }
 
+void SharedLock::lock() noexcept {
+    int      spin     = 0;
+    uint32_t expected = state.load(std::memory_order_relaxed);
+
+    // own writer bit, blocks new readers
+    while(true) {
+        if((expected & WRITER) == 0 &&
+           state.compare_exchange_weak(expected, expected | WRITER, std::memory_order_acquire, std::memory_order_relaxed)) {
+            break;
+        }
+        wait(spin);
+        expected = state.load(std::memory_order_relaxed);
+    }
+
+    // drain readers
+    while(state.load(std::memory_order_acquire) != WRITER) {
+        wait(spin);
+    }
+}
+
+void SharedLock::unlock() noexcept {
+    state.fetch_sub(WRITER, std::memory_order_release); // readers may be backing off
+}
+
+void SharedLock::lock_shared() noexcept {
+    int spin = 0;
+    while(true) {
+        if((state.load(std::memory_order_relaxed) & WRITER) == 0) {
+            if((state.fetch_add(1, std::memory_order_acquire) & WRITER) == 0) {
+                return; // entered
+            }
+            state.fetch_sub(1, std::memory_order_relaxed); // writer came first, back off
+        }
+        wait(spin);
+    }
+}
+
+void SharedLock::unlock_shared() noexcept {
+    state.fetch_sub(1, std::memory_order_release);
+}
+
+void SharedLock::wait(int& spin) noexcept {
+    if(++spin < SPIN) {
+#if (COMPILER == MSVC)
+        _mm_pause();
+#elif defined(__x86_64__) || defined(_M_X64)
+        asm volatile("pause" ::: "memory");
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+    else {
+        spin = 0;
+        std::this_thread::yield();
+    }
+}
+
 } // namespace async
 LWE_END
@@ -0,0 +1,131 @@
+/**************************************************************************************************
+ * LOCK-FREE BOUNDED QUEUE (power of 2 ring, index masking same as RingBuffer)
+ *
+ * memory layout
+ *   +-------------+-------------+-------------+
+ *   | cells, mask | head        | tail        |  < each on own cache line, no false sharing
+ *   +-------------+-------------+-------------+
+ *   cells
+ *   +-----+-----+-----+-- ... --+-----+
+ *   | [0] | [1] | [2] |         | [N] |  < position & (capacity - 1), positions only increase
+ *   +-----+-----+-----+-- ... --+-----+
+ *
+ * SpscQueue: one producer thread, one consumer thread
+ * - producer owns tail and a copy of head, consumer owns head and a copy of tail
+ * - push: full by the copy -> reload head once, no CAS
+ * - pull: empty by the copy -> reload tail once, no CAS
+ * - batch: one release store for all items
+ *
+ * MpmcQueue: any producer, any consumer (Vyukov bounded queue)
+ * - cell: sequence + data
+ * - push: sequence == pos         -> CAS tail, construct, sequence = pos + 1
+ * - pull: sequence == pos + 1     -> CAS head, move out,  sequence = pos + capacity
+ * - full: sequence <  pos         (consumer of last lap is not done)
+ * - batch: ready cells in a row are claimed by one CAS
+ *
+ * e.g. capacity 4, MpmcQueue
+ *   push a, b -> sequence [1][2][2][3]  tail 2
+ *   pull a    -> sequence [4][2][2][3]  head 1, cell [0] is free for pos 4
+ *
+ * NOTE: bounded, push fails when full and pull fails when empty, never blocks.
+ * NOTE: not copyable and not movable, share by reference.
+ **************************************************************************************************/
+
+#ifndef LWE_SYNC_QUEUE
+#define LWE_SYNC_QUEUE
+
+#include "../config/config.h"
+#include "../diag/diag.h"
+#include "../mem/system.hpp"
+
+LWE_BEGIN
+namespace async {
+
+//! @brief single producer single consumer lock-free bounded queue
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, typename A = mem::System> class SpscQueue {
+    static constexpr size_t LINE = 64; //!< cache line
+
+public:
+    //! @param [in] capacity: rounded up to power of 2
+    //! @throw diag::error(BAD_ALLOC)
+    SpscQueue(size_t = config::CAPACITY);
+    ~SpscQueue();
+
+public:
+    SpscQueue(const SpscQueue&)            = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+public:
+    template<typename U> bool push(U&&) noexcept; //!< producer only, false: full
+    bool                      pull(T&) noexcept;  //!< consumer only, false: empty, FIFO
+
+public:
+    size_t push(T*, size_t) noexcept; //!< producer only, move in, @return pushed count
+    size_t pull(T*, size_t) noexcept; //!< consumer only, move out to constructed, @return pulled count
+
+public:
+    size_t size() const noexcept;     //!< approximate while running
+    size_t capacity() const noexcept; //!< power of 2
+    bool   empty() const noexcept;    //!< approximate while running
+
+private:
+    T*           cells; //!< ring
+    const size_t mask;  //!< capacity - 1
+
+private:
+    alignas(LINE) std::atomic<size_t> head  = 0; //!< next to pull, written by consumer
+    size_t                            limit = 0; //!< consumer copy of tail
+
+private:
+    alignas(LINE) std::atomic<size_t> tail  = 0; //!< next to push, written by producer
+    size_t                            bound = 0; //!< producer copy of head
+};
+
+//! @brief multi producer multi consumer lock-free bounded queue
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, typename A = mem::System> class MpmcQueue {
+    static constexpr size_t LINE = 64; //!< cache line
+
+    struct Cell {
+        std::atomic<size_t> sequence;       //!< pos: free, pos + 1: filled
+        alignas(T) uint8_t  raw[sizeof(T)]; //!< data storage
+        T*                  data() noexcept { return reinterpret_cast<T*>(raw); }
+    };
+
+public:
+    //! @param [in] capacity: rounded up to power of 2, 2 or more
+    //! @throw diag::error(BAD_ALLOC)
+    MpmcQueue(size_t = config::CAPACITY);
+    ~MpmcQueue();
+
+public:
+    MpmcQueue(const MpmcQueue&)            = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+public:
+    template<typename U> bool push(U&&) noexcept; //!< false: full
+    bool                      pull(T&) noexcept;  //!< false: empty, FIFO per producer
+
+public:
+    size_t push(T*, size_t) noexcept; //!< move in, @return pushed count, in a row
+    size_t pull(T*, size_t) noexcept; //!< move out to constructed, @return pulled count, in a row
+
+public:
+    size_t size() const noexcept;     //!< approximate while running
+    size_t capacity() const noexcept; //!< power of 2
+    bool   empty() const noexcept;    //!< approximate while running
+
+private:
+    Cell*        cells; //!< ring
+    const size_t mask;  //!< capacity - 1
+
+private:
+    alignas(LINE) std::atomic<size_t> head = 0; //!< next to pull
+    alignas(LINE) std::atomic<size_t> tail = 0; //!< next to push
+};
+
+} // namespace async
+LWE_END
+#include "queue.ipp"
+#endif
@@ -0,0 +1,263 @@
+LWE_BEGIN
+namespace async {
+
+/**************************************************************************************************
+ * SpscQueue
+ **************************************************************************************************/
+
+template<typename T, typename A>
+SpscQueue<T, A>::SpscQueue(size_t in): cells(nullptr), mask(align(in < 2 ? 2 : in) - 1) {
+    cells = static_cast<T*>(A::allocate(sizeof(T) * (mask + 1)));
+    if(cells == nullptr) {
+        throw diag::error(diag::BAD_ALLOC);
+    }
+}
+
+template<typename T, typename A> SpscQueue<T, A>::~SpscQueue() {
+    // no thread is running, drain
+    size_t last = tail.load(std::memory_order_acquire);
+    for(size_t pos = head.load(std::memory_order_relaxed); pos != last; ++pos) {
+        cells[pos & mask].~T();
+    }
+    A::deallocate(cells);
+}
+
+template<typename T, typename A> template<typename U> bool SpscQueue<T, A>::push(U&& in) noexcept {
+    size_t pos = tail.load(std::memory_order_relaxed);
+    if(pos - bound > mask) {
+        bound = head.load(std::memory_order_acquire); // consumer may have moved
+        if(pos - bound > mask) {
+            return false; // full
+        }
+    }
+
+    new(cells + (pos & mask)) T(std::forward<U>(in));
+    tail.store(pos + 1, std::memory_order_release); // publish
+    return true;
+}
+
+template<typename T, typename A> bool SpscQueue<T, A>::pull(T& out) noexcept {
+    size_t pos = head.load(std::memory_order_relaxed);
+    if(pos == limit) {
+        limit = tail.load(std::memory_order_acquire); // producer may have moved
+        if(pos == limit) {
+            return false; // empty
+        }
+    }
+
+    T* cell = cells + (pos & mask);
+    out     = std::move(*cell);
+    cell->~T();
+    head.store(pos + 1, std::memory_order_release); // free
+    return true;
+}
+
+template<typename T, typename A> size_t SpscQueue<T, A>::push(T* in, size_t n) noexcept {
+    size_t pos  = tail.load(std::memory_order_relaxed);
+    size_t room = mask + 1 - (pos - bound);
+    if(room < n) {
+        bound = head.load(std::memory_order_acquire);
+        room  = mask + 1 - (pos - bound);
+    }
+    if(n > room) {
+        n = room;
+    }
+
+    for(size_t i = 0; i < n; ++i) {
+        new(cells + ((pos + i) & mask)) T(std::move(in[i]));
+    }
+    if(n) {
+        tail.store(pos + n, std::memory_order_release); // publish all
+    }
+    return n;
+}
+
+template<typename T, typename A> size_t SpscQueue<T, A>::pull(T* out, size_t n) noexcept {
+    size_t pos   = head.load(std::memory_order_relaxed);
+    size_t ready = limit - pos;
+    if(ready < n) {
+        limit = tail.load(std::memory_order_acquire);
+        ready = limit - pos;
+    }
+    if(n > ready) {
+        n = ready;
+    }
+
+    for(size_t i = 0; i < n; ++i) {
+        T* cell = cells + ((pos + i) & mask);
+        out[i]  = std::move(*cell);
+        cell->~T();
+    }
+    if(n) {
+        head.store(pos + n, std::memory_order_release); // free all
+    }
+    return n;
+}
+
+template<typename T, typename A> size_t SpscQueue<T, A>::size() const noexcept {
+    size_t first = head.load(std::memory_order_relaxed);
+    size_t last  = tail.load(std::memory_order_relaxed);
+    return last - first <= mask + 1 ? last - first : 0; // head read first, tail is not behind
+}
+
+template<typename T, typename A> size_t SpscQueue<T, A>::capacity() const noexcept {
+    return mask + 1;
+}
+
+template<typename T, typename A> bool SpscQueue<T, A>::empty() const noexcept {
+    return size() == 0;
+}
+
+/**************************************************************************************************
+ * MpmcQueue
+ **************************************************************************************************/
+
+template<typename T, typename A>
+MpmcQueue<T, A>::MpmcQueue(size_t in): cells(nullptr), mask(align(in < 2 ? 2 : in) - 1) {
+    cells = static_cast<Cell*>(A::allocate(sizeof(Cell) * (mask + 1)));
+    if(cells == nullptr) {
+        throw diag::error(diag::BAD_ALLOC);
+    }
+    for(size_t i = 0; i <= mask; ++i) {
+        new(cells + i) Cell;
+        cells[i].sequence.store(i, std::memory_order_relaxed); // free for pos i
+    }
+}
+
+template<typename T, typename A> MpmcQueue<T, A>::~MpmcQueue() {
+    // no thread is running, drain
+    size_t last = tail.load(std::memory_order_acquire);
+    for(size_t pos = head.load(std::memory_order_relaxed); pos != last; ++pos) {
+        cells[pos & mask].data()->~T();
+    }
+    A::deallocate(cells);
+}
+
+template<typename T, typename A> template<typename U> bool MpmcQueue<T, A>::push(U&& in) noexcept {
+    Cell*  cell = nullptr;
+    size_t pos  = tail.load(std::memory_order_relaxed);
+    while(true) {
+        cell          = cells + (pos & mask);
+        ssize_t delta = ssize_t(cell->sequence.load(std::memory_order_acquire) - pos);
+        if(delta == 0) {
+            if(tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break; // claimed
+            }
+        }
+        else if(delta < 0) {
+            return false; // full
+        }
+        else pos = tail.load(std::memory_order_relaxed); // other producer claimed
+    }
+
+    new(cell->data()) T(std::forward<U>(in));
+    cell->sequence.store(pos + 1, std::memory_order_release); // publish
+    return true;
+}
+
+template<typename T, typename A> bool MpmcQueue<T, A>::pull(T& out) noexcept {
+    Cell*  cell = nullptr;
+    size_t pos  = head.load(std::memory_order_relaxed);
+    while(true) {
+        cell          = cells + (pos & mask);
+        ssize_t delta = ssize_t(cell->sequence.load(std::memory_order_acquire) - (pos + 1));
+        if(delta == 0) {
+            if(head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break; // claimed
+            }
+        }
+        else if(delta < 0) {
+            return false; // empty
+        }
+        else pos = head.load(std::memory_order_relaxed); // other consumer claimed
+    }
+
+    T* data = cell->data();
+    out     = std::move(*data);
+    data->~T();
+    cell->sequence.store(pos + mask + 1, std::memory_order_release); // free for next lap
+    return true;
+}
+
+template<typename T, typename A> size_t MpmcQueue<T, A>::push(T* in, size_t n) noexcept {
+    size_t pos   = tail.load(std::memory_order_relaxed);
+    size_t count = 0;
+    while(n) {
+        // free cells in a row from pos
+        for(count = 0; count < n; ++count) {
+            size_t seq = cells[(pos + count) & mask].sequence.load(std::memory_order_acquire);
+            if(seq != pos + count) {
+                break;
+            }
+        }
+
+        if(count == 0) {
+            ssize_t delta = ssize_t(cells[pos & mask].sequence.load(std::memory_order_relaxed) - pos);
+            if(delta < 0) {
+                return 0; // full
+            }
+            pos = tail.load(std::memory_order_relaxed); // other producer claimed
+        }
+        else if(tail.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+            break; // claimed all
+        }
+    }
+
+    for(size_t i = 0; i < count; ++i) {
+        Cell* cell = cells + ((pos + i) & mask);
+        new(cell->data()) T(std::move(in[i]));
+        cell->sequence.store(pos + i + 1, std::memory_order_release); // publish
+    }
+    return count;
+}
+
+template<typename T, typename A> size_t MpmcQueue<T, A>::pull(T* out, size_t n) noexcept {
+    size_t pos   = head.load(std::memory_order_relaxed);
+    size_t count = 0;
+    while(n) {
+        // filled cells in a row from pos
+        for(count = 0; count < n; ++count) {
+            size_t seq = cells[(pos + count) & mask].sequence.load(std::memory_order_acquire);
+            if(seq != pos + count + 1) {
+                break;
+            }
+        }
+
+        if(count == 0) {
+            ssize_t delta = ssize_t(cells[pos & mask].sequence.load(std::memory_order_relaxed) - (pos + 1));
+            if(delta < 0) {
+                return 0; // empty
+            }
+            pos = head.load(std::memory_order_relaxed); // other consumer claimed
+        }
+        else if(head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+            break; // claimed all
+        }
+    }
+
+    for(size_t i = 0; i < count; ++i) {
+        Cell* cell = cells + ((pos + i) & mask);
+        T*    data = cell->data();
+        out[i]     = std::move(*data);
+        data->~T();
+        cell->sequence.store(pos + i + mask + 1, std::memory_order_release); // free for next lap
+    }
+    return count;
+}
+
+template<typename T, typename A> size_t MpmcQueue<T, A>::size() const noexcept {
+    size_t first = head.load(std::memory_order_relaxed);
+    size_t last  = tail.load(std::memory_order_relaxed);
+    return last - first <= mask + 1 ? last - first : 0; // head read first, tail is not behind
+}
+
+template<typename T, typename A> size_t MpmcQueue<T, A>::capacity() const noexcept {
+    return mask + 1;
+}
+
+template<typename T, typename A> bool MpmcQueue<T, A>::empty() const noexcept {
+    return size() == 0;
+}
+
+} // namespace async
+LWE_END
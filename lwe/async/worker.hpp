@@ -23,6 +23,16 @@ public:
     //! @brief insert lambda
     void submit(Task);
 
+public:
+    //! @brief run fn(i) for i in [0, count) on pool and this thread, wait all
+    //! @param [in] count: part count
+    //! @param [in] fn: void(size_t), called concurrently, must not throw
+    //! @note parts left by busy or terminated threads run on this thread
+    template<typename F> void dispatch(size_t, F&&);
+
+public:
+    size_t size() const noexcept; //!< thread count
+
 private:
     //! worker thread work
     void run();
@@ -34,12 +44,10 @@ public:
 private:
     std::vector<std::thread> workers; //!< thread pool
     std::condition_variable  event;   //!< submit wake condition
-    std::mutex               lock;    //!< cv mutex
-    std::mutex               mtx;     //!< container mutex
+    std::mutex               mtx;     //!< container and cv mutex
     stl::Deque<Task>         tasks;   //!< task queue
     std::once_flag           flag;    //!< terminate called flag
     std::atomic_bool         stop;    //!< submit stop flag
-    std::atomic_bool         end;     //!< worker end flag
 }; // namespace async
 
 } // namespace async
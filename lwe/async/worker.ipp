@@ -1,7 +1,7 @@
 LWE_BEGIN
 namespace async {
 
-Worker::Worker(size_t count): end(false), stop(false) {
+Worker::Worker(size_t count): stop(false) {
     if(count < 1) {
         count = 1;
     }
@@ -17,49 +17,74 @@ Worker::~Worker() {
 
 void Worker::submit(Task in) {
     LOCKGUARD(mtx) {
-        if(!stop.load(std::memory_order_acquire)) {
+        if(!stop.load(std::memory_order_relaxed)) {
             tasks.push(std::move(in));
         }
     }
     event.notify_one(); // wake up
 }
 
-void Worker::run() {
-    while(!end.load(std::memory_order_relaxed)) {
-        std::unique_lock guard(lock);
-        event.wait(guard, [this]() {
-            return end.load(std::memory_order_relaxed) ||  // terminated
-                   stop.load(std::memory_order_acquire) || // no more submit
-                   !tasks.empty();                         // has message
-        });
+template<typename F> void Worker::dispatch(size_t count, F&& fn) {
+    struct Shared {
+        std::atomic<size_t>     next{ 0 }; // next part to claim
+        std::atomic<size_t>     done{ 0 }; // finished part count
+        std::mutex              mtx;       // cv mutex
+        std::condition_variable event;     // all done
+    };
+
+    if(count == 0) {
+        return;
+    }
 
-        // check end and empty
-        if(end.load(std::memory_order_relaxed)) {
-            return; // return
+    // claim and run until no part left
+    // fn is touched only after a claim, late helper is safe after return
+    std::shared_ptr<Shared> shared = std::make_shared<Shared>();
+    auto                    part   = [shared, count, &fn]() {
+        for(size_t i = shared->next.fetch_add(1, std::memory_order_relaxed); i < count;
+            i        = shared->next.fetch_add(1, std::memory_order_relaxed)) {
+            fn(i);
+            if(shared->done.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+                LOCKGUARD(shared->mtx) shared->event.notify_all(); // last
+            }
         }
+    };
 
-        // run
+    // helpers, this thread is one of them
+    size_t helpers = count - 1 < workers.size() ? count - 1 : workers.size();
+    for(size_t i = 0; i < helpers; ++i) {
+        submit(part);
+    }
+    part();
+
+    std::unique_lock guard(shared->mtx);
+    shared->event.wait(guard, [&shared, count]() { return shared->done.load(std::memory_order_acquire) == count; });
+}
+
+size_t Worker::size() const noexcept {
+    return workers.size();
+}
+
+void Worker::run() {
+    while(true) {
         Task task;
-        bool result;
-        LOCKGUARD(mtx) result = tasks.shift(task);
-        if(result) {
-            task();
-        }
+        {
+            std::unique_lock guard(mtx);
+            event.wait(guard, [this]() {
+                return stop.load(std::memory_order_relaxed) || // no more submit
+                       !tasks.empty();                         // has message
+            });
 
-        // last task
-        // use relaxed reason
-        // - terminate() -> "stop = true" and "end = true"
-        // - submit() -> "stop == true", not work
-        // - "stop = ture" after "tasks.push()" -> use lock guard, safe
-        // - "end = true" after "while(!end)" -> call event.wait(end), safe
-        if(stop.load(std::memory_order_acquire) && tasks.empty()) {
-            end.store(true, std::memory_order_relaxed); // set end flag, all thread joinable
+            // stopped and drained
+            if(!tasks.pull(task)) {
+                return;
+            }
         }
+        task(); // run unlocked, tasks run in parallel
     }
 }
 
 void Worker::terminate() {
-    stop.store(true, std::memory_order_release); // no more submissions accepted.
+    LOCKGUARD(mtx) stop.store(true, std::memory_order_relaxed); // no more submissions accepted, no lost wake up
     std::call_once(flag, [this]() {
         event.notify_all(); // wake up all
         // join and wait
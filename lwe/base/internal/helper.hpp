@@ -23,7 +23,7 @@ inline static constexpr uint64_t align(uint64_t in) noexcept {
         return 1;
     }
     in -= 1;
-    for(uint64_t i = 1; i < sizeof(uint64_t); i <<= 1) {
+    for(uint64_t i = 1; i < (sizeof(uint64_t) << 3); i <<= 1) {
         in |= in >> i;
     }
     return in + 1;
@@ -103,6 +103,72 @@ template<typename T> inline void memfree(T* in) noexcept {
     free(*(reinterpret_cast<void**>(in) - 1));
 }
 
+/**
+ * @brief MSVC _aligned_malloc / C++17 aligned_alloc, without metadata
+ * @note  address is aligned to alignment itself, use alignfree to release
+ *
+ * @param [in] size corrected to multiples of alignment
+ * @param [in] alignment corrected to by powers of 2
+ * @return void* allocated pointer
+ */
+template<typename T = void> inline T* alignalloc(size_t size, size_t alignment) noexcept {
+    alignment = align(alignment);
+    if(alignment < sizeof(void*)) {
+        alignment = sizeof(void*);
+    }
+    size = align(size, alignment); // follow the C++17 standards
+#if COMPILER == MSVC
+    return static_cast<T*>(_aligned_malloc(size, alignment));
+#else
+    return static_cast<T*>(std::aligned_alloc(alignment, size));
+#endif
+}
+
+/**
+ * @brief MSVC _aligned_free / C++17 free
+ *
+ * @param [in] in pointer from alignalloc
+ */
+template<typename T> inline void alignfree(T* in) noexcept {
+#if COMPILER == MSVC
+    _aligned_free(in);
+#else
+    free(in);
+#endif
+}
+
+/**
+ * @brief hint to load cache line of address, no effect when unsupported
+ *
+ * @param [in] in address to read soon
+ */
+inline void prefetch(const void* in) noexcept {
+#if COMPILER == MSVC
+#    if defined(_M_X64) || defined(_M_IX86)
+    _mm_prefetch(static_cast<const char*>(in), _MM_HINT_T0);
+#    else
+    (void)in;
+#    endif
+#else
+    __builtin_prefetch(in);
+#endif
+}
+
+/**
+ * @brief bytes of T can be moved by memcpy / memmove, no move constructor and destructor of source
+ * @note  specialize for a type that does not point to itself, e.g.
+ *        LWE_BEGIN namespace core { template<> struct Relocatable<MyType>: std::true_type { }; } LWE_END
+ */
+template<typename T> struct Relocatable: std::bool_constant<std::is_trivially_copyable_v<T>> { };
+
+template<typename K, typename V> struct Relocatable<std::pair<K, V>>
+    : std::bool_constant<Relocatable<K>::value && Relocatable<V>::value> { };
+
+// MSVC release / libc++ string: no self pointer, libstdc++ SSO points to itself
+#if (COMPILER == MSVC && _ITERATOR_DEBUG_LEVEL == 0) || defined(_LIBCPP_VERSION)
+template<typename C, typename T, typename A> struct Relocatable<std::basic_string<C, T, A>>: std::true_type { };
+#endif
+
 } // namespace core
 
 LWE_END
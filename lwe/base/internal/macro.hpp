@@ -161,6 +161,7 @@
 #define MESSAGE(x) message(__FILE__ " [" MACRO(__LINE__) "] " #x)
 
 #define LOCKGUARD(lock) if(std::lock_guard<decltype(lock)> MACRO_lock_guard(lock); true)
+#define SHAREDGUARD(lock) if(std::shared_lock<decltype(lock)> MACRO_shared_guard(lock); true)
 
 // clang-format off
 
@@ -4,8 +4,13 @@
 /**************************************************************************************************
  * C LIBRARIES
  **************************************************************************************************/
+#include <cstddef>
 #include <cstdlib>
 #include <cstdint>
+#if defined(_MSC_VER)
+#    include <malloc.h> // _aligned_malloc
+#    include <intrin.h> // _mm_prefetch
+#endif
 
 /**************************************************************************************************
  * UTILITY
@@ -31,6 +36,7 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <shared_mutex>
 
 /**************************************************************************************************
  * TOOL
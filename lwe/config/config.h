@@ -28,6 +28,38 @@ inline constexpr size_t
     BLOCK = align(SET_BLOCK, 1'024);
 #endif
 
+//! memory pool chunk without header, block is aligned to own size (bool)
+inline constexpr bool
+#ifndef SET_HEADERLESS
+    HEADERLESS = false;
+#else
+    HEADERLESS = SET_HEADERLESS;
+#endif
+
+//! memory pool decay delay, freeable block is released after idle time (ms)
+inline constexpr size_t
+#ifndef SET_DECAY
+    DECAY = 1'000;
+#else
+    DECAY = SET_DECAY;
+#endif
+
+//! memory pool freeable block count kept on decay (count)
+inline constexpr size_t
+#ifndef SET_RETAIN
+    RETAIN = 1;
+#else
+    RETAIN = SET_RETAIN;
+#endif
+
+//! memory pool thread-local cache size (count), 0 is disable
+inline constexpr size_t
+#ifndef SET_MAGAZINE
+    MAGAZINE = 64;
+#else
+    MAGAZINE = SET_MAGAZINE;
+#endif
+
 //! small vector optimize (byte)
 inline constexpr size_t
 #ifndef SET_SMALLVECTOR
@@ -36,6 +68,46 @@ inline constexpr size_t
     SMALLVECTOR = SET_SMALLVECTOR;
 #endif
 
+//! util::ID thread-local reserved range (count), 1 is shared counter only
+inline constexpr uint64_t
+#ifndef SET_IDRANGE
+    IDRANGE = 4'096;
+#else
+    IDRANGE = SET_IDRANGE < 1 ? 1 : SET_IDRANGE;
+#endif
+
+//! hash table incremental rehash, buckets migrated per insert / erase (count), 0 is rehash at once
+inline constexpr size_t
+#ifndef SET_REHASHSTEP
+    REHASHSTEP = 0;
+#else
+    REHASHSTEP = SET_REHASHSTEP;
+#endif
+
+//! concurrent hash table lock segment count (count), power of 2
+inline constexpr size_t
+#ifndef SET_SEGMENTS
+    SEGMENTS = 64;
+#else
+    SEGMENTS = align(SET_SEGMENTS);
+#endif
+
+//! hash container decode, element count to bulk build on a worker pool (count)
+inline constexpr size_t
+#ifndef SET_PARALLELBUILD
+    PARALLELBUILD = 65'536;
+#else
+    PARALLELBUILD = SET_PARALLELBUILD;
+#endif
+
+//! ordered tree container node size (byte), multiple of cache line
+inline constexpr size_t
+#ifndef SET_TREENODE
+    TREENODE = 256;
+#else
+    TREENODE = align(SET_TREENODE, 64);
+#endif
+
 // default hash table load factor (ratio)
 inline constexpr float
 #ifndef SET_LOADFACTOR
@@ -0,0 +1,101 @@
+/**************************************************************************************************
+ * CONCURRENT HASH MAP with lock segments (HashedBuffer per segment)
+ *
+ * hashing
+ * - hash    -> util::Hash<K>, once per call
+ * - mixed   -> hash * Fibonacci prime (HashedBuffer::indexof)
+ * - segment -> top bits of mixed
+ * - bucket  -> top bits of mixed * Fibonacci prime, inside the segment (mixed is the buffer hash)
+ *   aligned keys (pointers, multiples of 2^n) leave low bits of mixed zero, top bits are spread
+ *
+ * memory layout
+ *   +----------------+----------------+-- ... --+----------------+
+ *   | lock | buffer  | lock | buffer  |         | lock | buffer  |  < cache line aligned
+ *   +----------------+----------------+-- ... --+----------------+
+ *    segment [0]      segment [1]                segment [SEGMENTS - 1]
+ *
+ * locking
+ * - read  (find / visit / exist / each) -> shared, readers never block each other
+ * - write (insert / assign / compute / pop) -> exclusive, one segment only
+ * - resize -> per segment under its exclusive lock, other segments are not blocked
+ *             incremental rehash bounds the time a writer holds the lock
+ *
+ * NOTE: no iterator, values are accessed by copy or under lock (visit / compute / each).
+ * NOTE: callbacks run under segment lock, do not access the same table in them.
+ **************************************************************************************************/
+
+#ifndef LWE_CONTAINER_CONCURRENT_HASH_TABLE
+#define LWE_CONTAINER_CONCURRENT_HASH_TABLE
+
+#include "../config/config.h"
+#include "../async/lock.hpp"
+#include "hash_table.hpp"
+
+LWE_BEGIN
+namespace container {
+
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename K, typename V, typename A = mem::System> class ConcurrentHashTable {
+public:
+    using Entry     = Record<K, V>;
+    using Allocator = A;
+
+private:
+    using Buffer = HashedBuffer<Entry, A>;
+    using Bucket = typename Buffer::Bucket;
+    using Chain  = typename Buffer::Chain;
+
+    struct alignas(64) Segment {
+        mutable async::SharedLock lock;   // segment lock
+        Buffer                    buffer; // segment data
+    };
+
+    static constexpr size_t SEGMENTS = config::SEGMENTS;
+    static constexpr size_t SEGLOG   = core::nlog(SEGMENTS); //!< segment index bits
+
+public:
+    //! @brief constructor
+    //! @param [in] step: incremental rehash step of each segment, 0: rehash at once
+    ConcurrentHashTable(size_t step = 2);
+
+public:
+    ConcurrentHashTable(const ConcurrentHashTable&)            = delete;
+    ConcurrentHashTable& operator=(const ConcurrentHashTable&) = delete;
+
+public:
+    template<typename T, typename U> bool insert(T&&, U&&);           //!< insert when absent
+    template<typename T, typename U> bool insert_or_assign(T&&, U&&); //!< true: inserted, false: assigned
+    bool                                  pop(const K&);              //!< erase
+
+public:
+    //! @brief atomic update
+    //! @param [in] key: key
+    //! @param [in] fn: void(V&), value is default constructed when absent
+    //! @return true: inserted, false: updated
+    template<typename F> bool compute(const K&, F&&);
+
+public:
+    bool                      find(const K&, V&) const;   //!< copy value out
+    bool                      exist(const K&) const;      //!< check key
+    template<typename F> bool visit(const K&, F&&) const; //!< call void(const V&) under shared lock
+    template<typename F> void each(F&&) const;            //!< call void(const K&, const V&), segment by segment
+
+public:
+    size_t size() const noexcept; //!< total element count, not a snapshot
+    size_t used() const noexcept; //!< non-empty segment count, lock distribution check
+    bool   reserve(size_t);       //!< reserve each segment
+    void   clear();               //!< clear all segments
+
+private:
+    //! @brief hash to segment
+    //! @param [in, out] hash: util::Hash, mixed on return, pass it to the segment buffer
+    Segment& segment(hash_t&) const noexcept;
+
+private:
+    mutable Segment segments[SEGMENTS];
+};
+
+} // namespace container
+LWE_END
+#include "concurrent_hash_table.ipp"
+#endif
@@ -0,0 +1,165 @@
+LWE_BEGIN
+namespace container {
+
+template<typename K, typename V, typename A> ConcurrentHashTable<K, V, A>::ConcurrentHashTable(size_t step) {
+    for(Segment& it : segments) {
+        it.buffer.incremental(step);
+    }
+}
+
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool ConcurrentHashTable<K, V, A>::insert(T&& key, U&& value) {
+    hash_t   hashed = util::Hash<K>(key);
+    Segment& seg    = segment(hashed);
+    LOCKGUARD(seg.lock) {
+        if(seg.buffer.locate(hashed, [&key](const Entry& it) { return it.first == key; }) != nullptr) {
+            return false; // exist
+        }
+        if(!seg.buffer.grow()) {
+            return false; // bad alloc
+        }
+        return seg.buffer.emplace(Entry{ std::forward<T>(key), std::forward<U>(value) }, hashed);
+    }
+    return false;
+}
+
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool ConcurrentHashTable<K, V, A>::insert_or_assign(T&& key, U&& value) {
+    hash_t   hashed = util::Hash<K>(key);
+    Segment& seg    = segment(hashed);
+    LOCKGUARD(seg.lock) {
+        Chain* pos = seg.buffer.locate(hashed, [&key](const Entry& it) { return it.first == key; });
+        if(pos != nullptr) {
+            pos->data.second = std::forward<U>(value);
+            return false; // assigned
+        }
+        if(!seg.buffer.grow()) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+        if(!seg.buffer.emplace(Entry{ std::forward<T>(key), std::forward<U>(value) }, hashed)) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A> bool ConcurrentHashTable<K, V, A>::pop(const K& key) {
+    hash_t   hashed = util::Hash<K>(key);
+    Segment& seg    = segment(hashed);
+    LOCKGUARD(seg.lock) {
+        Bucket* bucket = nullptr; // owner
+        Chain*  pos    = seg.buffer.locate(hashed, [&key](const Entry& it) { return it.first == key; }, &bucket);
+        if(pos == nullptr) {
+            return false; // not found
+        }
+        seg.buffer.remove(bucket, pos);
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename F> bool ConcurrentHashTable<K, V, A>::compute(const K& key, F&& fn) {
+    hash_t   hashed = util::Hash<K>(key);
+    Segment& seg    = segment(hashed);
+    LOCKGUARD(seg.lock) {
+        Chain* pos = seg.buffer.locate(hashed, [&key](const Entry& it) { return it.first == key; });
+        if(pos != nullptr) {
+            fn(pos->data.second);
+            return false; // updated
+        }
+
+        // insert default and update
+        if(!seg.buffer.grow() || !seg.buffer.emplace(Entry{ key, V{} }, hashed)) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+        fn(seg.buffer.locate(hashed, [&key](const Entry& it) { return it.first == key; })->data.second);
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A> bool ConcurrentHashTable<K, V, A>::find(const K& key, V& out) const {
+    return visit(key, [&out](const V& it) { out = it; });
+}
+
+template<typename K, typename V, typename A> bool ConcurrentHashTable<K, V, A>::exist(const K& key) const {
+    return visit(key, [](const V&) {});
+}
+
+template<typename K, typename V, typename A>
+template<typename F> bool ConcurrentHashTable<K, V, A>::visit(const K& key, F&& fn) const {
+    hash_t   hashed = util::Hash<K>(key);
+    Segment& seg    = segment(hashed);
+    SHAREDGUARD(seg.lock) {
+        const Chain* pos = seg.buffer.locate(hashed, [&key](const Entry& it) { return it.first == key; });
+        if(pos == nullptr) {
+            return false; // not found
+        }
+        fn(pos->data.second);
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename F> void ConcurrentHashTable<K, V, A>::each(F&& fn) const {
+    for(const Segment& seg : segments) {
+        SHAREDGUARD(seg.lock) {
+            for(const Entry& it : seg.buffer) {
+                fn(it.first, it.second);
+            }
+        }
+    }
+}
+
+template<typename K, typename V, typename A> size_t ConcurrentHashTable<K, V, A>::size() const noexcept {
+    size_t total = 0;
+    for(const Segment& seg : segments) {
+        SHAREDGUARD(seg.lock) {
+            total += seg.buffer.size();
+        }
+    }
+    return total;
+}
+
+template<typename K, typename V, typename A> size_t ConcurrentHashTable<K, V, A>::used() const noexcept {
+    size_t count = 0;
+    for(const Segment& seg : segments) {
+        SHAREDGUARD(seg.lock) {
+            count += seg.buffer.size() != 0;
+        }
+    }
+    return count;
+}
+
+template<typename K, typename V, typename A> bool ConcurrentHashTable<K, V, A>::reserve(size_t in) {
+    size_t each = (in + SEGMENTS - 1) / SEGMENTS;
+    for(Segment& seg : segments) {
+        LOCKGUARD(seg.lock) {
+            if(!seg.buffer.reserve(each)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A> void ConcurrentHashTable<K, V, A>::clear() {
+    for(Segment& seg : segments) {
+        LOCKGUARD(seg.lock) {
+            seg.buffer.clear();
+        }
+    }
+}
+
+template<typename K, typename V, typename A>
+auto ConcurrentHashTable<K, V, A>::segment(hash_t& in) const noexcept -> Segment& {
+    // whole fibonacci product, its top bits select the segment
+    // the buffer multiplies it again for buckets, so bucket bits do not repeat the segment bits
+    in = segments[0].buffer.indexof(in, sizeof(size_t) << 3);
+    if constexpr(SEGLOG == 0) {
+        return segments[0];
+    }
+    else return segments[in >> ((sizeof(size_t) << 3) - SEGLOG)];
+}
+
+} // namespace container
+LWE_END
@@ -0,0 +1,156 @@
+/**************************************************************************************************
+ * HASH SET with dense storage (insertion order, positions only in the hash index)
+ *
+ * hashing
+ * - hash  -> util::Hash<T>, stored with data (index rebuild reads no data)
+ * - mixed -> hash * Fibonacci prime
+ * - home  -> top log2(capacity) bits of mixed
+ * - tag   -> 32 bits folded hash, stored in index (most misses never touch items)
+ *
+ * memory layout
+ *   index (power of 2, linear probing)
+ *   +-------+-------+-------+-------+-- ... --+
+ *   | 2,tag | empty | 0,tag | 1,tag |         |  < position in items + tag
+ *   +-------+-------+-------+-------+-- ... --+
+ *
+ *   items (LinearBuffer)
+ *   +-------+-------+-------+
+ *   |  [0]  |  [1]  |  [2]  |  < data + hash, insertion order
+ *   +-------+-------+-------+
+ *
+ * - iterate : linear scan of items, cost is element count, not capacity
+ * - at(i)   : items[i], O(1)
+ * - grow    : index only is rebuilt, items are never moved or reordered
+ * - erase   : order kept, later items shift down and their positions are updated (O(n))
+ *             last item is O(1), index slot is freed by backward shift (no tombstone)
+ *
+ * NOTE: load factor is capped to 7/8.
+ * NOTE: element count is limited to 2^32 - 1.
+ * NOTE: insert and erase invalidate iterators after the position of change.
+ **************************************************************************************************/
+
+#ifndef LWE_CONTAINER_DENSE_BUFFER
+#define LWE_CONTAINER_DENSE_BUFFER
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../util/hash.hpp"
+#include "../mem/system.hpp"
+#include "iterator.hpp"
+#include "linear_buffer.hpp"
+
+LWE_BEGIN
+namespace async {
+class Worker; //!< bulk build, see async/worker.hpp
+} // namespace async
+
+namespace container {
+
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, typename A = mem::System> class DenseBuffer {
+public:
+    template<typename, typename, typename> friend class DenseTable; //!< for composition
+
+public:
+    CONTAINER_BODY(DenseBuffer, T, T, A);
+    using Allocator = A;
+
+private:
+    struct Slot {
+        T      data; // data
+        hash_t hash; // calculated hash
+    };
+
+    struct Index {
+        uint32_t pos; // position in items, EMPTY: empty
+        uint32_t tag; // folded hash
+    };
+
+    static constexpr uint32_t EMPTY = ~uint32_t(0);
+    static constexpr size_t   NONE  = ~size_t(0);
+
+public:
+    //! @brief constructor
+    //! @param [in] factor: load factor, max 0.875
+    DenseBuffer(float factor = config::LOADFACTOR);
+
+public:
+    ~DenseBuffer();                                 //!< free
+    DenseBuffer(const DenseBuffer&);                //!< deep copy
+    DenseBuffer(DenseBuffer&&) noexcept;            //!< move
+    DenseBuffer& operator=(const DenseBuffer&);     //!< deep copy
+    DenseBuffer& operator=(DenseBuffer&&) noexcept; //!< move
+
+public:
+    bool push(T&&);                      //!< push back
+    bool push(const T&);                 //!< push back
+    bool pop(const T&) noexcept;         //!< pop, order kept
+    bool exist(const T&) const noexcept; //!< check data
+
+public:
+    template<typename U> bool insert(U&&);                          //!< insert
+    bool                      erase(const Iterator<FWD>&) noexcept; //!< iterator erase
+
+public:
+    size_t size() const noexcept;     //!< element count
+    size_t capacity() const noexcept; //!< index slot count
+
+public:
+    bool reserve(size_t) noexcept; //!< reserve items and index for count
+    void clear() noexcept;         //!< clear, but no shrink
+
+public:
+    //! @brief bulk build, sizes the table once
+    //! @param [in] in: data array, moved out when inserted
+    //! @param [in] n: data count
+    //! @param [in] worker: unused, items keep input order
+    //! @return false: bad alloc
+    template<typename W = async::Worker> bool build(T*, size_t, W* = nullptr);
+
+public:
+    Iterator<FWD> find(const T&) noexcept; //!< find by data
+    Iterator<FWD> at(size_t) noexcept;     //!< find by order, O(1)
+    Iterator<FWD> begin() noexcept;        //!< get begin
+    Iterator<FWD> end() noexcept;          //!< get end
+
+public:
+    Iterator<FWD | VIEW> find(const T&) const noexcept; //!< find by data const
+    Iterator<FWD | VIEW> at(size_t) const noexcept;     //!< find by order const, O(1)
+    Iterator<FWD | VIEW> begin() const noexcept;        //!< get begin const
+    Iterator<FWD | VIEW> end() const noexcept;          //!< get end const
+
+private:
+    template<typename F> size_t probe(hash_t, F&&) const noexcept; //!< index slot of matched, NONE: not found
+    size_t                      owner(size_t) const noexcept;      //!< index slot of item position
+
+private:
+    template<typename U> bool emplace(U&&, hash_t); //!< push detail, no duplicate check
+    void                      remove(size_t);       //!< pop detail, index slot
+
+private:
+    bool rehash(size_t);                   //!< index resize, rebuilt from items
+    void place(hash_t, uint32_t) noexcept; //!< put position to first empty of probe sequence
+
+private:
+    size_t          home(hash_t) const noexcept; //!< first probe index
+    static uint32_t tag(hash_t) noexcept;        //!< 32 bits folded hash
+
+private:
+    size_t limit(size_t) const noexcept; //!< max element count of capacity
+
+private:
+    size_t capacitor = 0; //!< index slot counter
+    size_t log       = 0; //!< log2(capacitor)
+
+private:
+    LinearBuffer<Slot, 0, A> items;           //!< dense data, insertion order
+    Index*                   index = nullptr; //!< positions
+
+public:
+    const float LOAD_FACTOR;
+};
+
+} // namespace container
+LWE_END
+#include "dense_buffer.ipp"
+#endif
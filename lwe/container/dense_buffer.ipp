@@ -0,0 +1,366 @@
+LWE_BEGIN
+namespace container {
+/**************************************************************************************************
+ * Iterator
+ **************************************************************************************************/
+REGISTER_CONST_ITERATOR((typename T, typename A), FWD, DenseBuffer, T, A);
+
+template<typename T, typename A> class Iterator<FWD, DenseBuffer<T, A>> {
+    ITERATOR_BODY(FWD, DenseBuffer, T, A);
+    friend DenseBuffer; //!< erase
+
+public:
+    Iterator(DenseBuffer* self, size_t index): self(self), index(index) { }
+
+public:
+    Iterator& operator++() {
+        if(index != self->items.size()) {
+            ++index;
+        }
+        return *this;
+    }
+
+    Iterator& operator--() {
+        if(index != 0) {
+            --index;
+        }
+        return *this;
+    }
+
+public:
+    T& operator*() { return self->items[index].data; }
+
+    const T& operator*() const { return const_cast<Iterator*>(this)->operator*(); }
+
+    T* operator->() { return &this->operator*(); }
+
+    const T* operator->() const { return &this->operator*(); }
+
+public:
+    bool operator==(const Iterator& in) const { return self == in.self && index == in.index; }
+
+    bool operator!=(const Iterator& in) const { return !operator==(in); }
+
+private:
+    DenseBuffer* self;
+    size_t       index; // position in items
+};
+
+/**************************************************************************************************
+ * DenseBuffer
+ **************************************************************************************************/
+
+template<typename T, typename A> DenseBuffer<T, A>::DenseBuffer(float factor): LOAD_FACTOR(factor) { }
+
+template<typename T, typename A> DenseBuffer<T, A>::~DenseBuffer() {
+    A::deallocate(index);
+}
+
+template<typename T, typename A>
+DenseBuffer<T, A>::DenseBuffer(const DenseBuffer& in): items(in.items), LOAD_FACTOR(in.LOAD_FACTOR) {
+    if(in.capacitor != 0 && (items.size() != in.items.size() || !rehash(in.capacitor))) {
+        items.clear(); // bad alloc
+    }
+}
+
+template<typename T, typename A>
+DenseBuffer<T, A>::DenseBuffer(DenseBuffer&& in) noexcept:
+    capacitor(in.capacitor),
+    log(in.log),
+    items(std::move(in.items)),
+    index(in.index),
+    LOAD_FACTOR(in.LOAD_FACTOR) {
+    in.capacitor = 0;
+    in.log       = 0;
+    in.index     = nullptr;
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::operator=(const DenseBuffer& in) -> DenseBuffer& {
+    if(this != &in) {
+        clear();
+        if(reserve(in.items.size())) {
+            for(size_t i = 0; i < in.items.size(); ++i) {
+                emplace(in.items[i].data, in.items[i].hash); // copy, keep order
+            }
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::operator=(DenseBuffer&& in) noexcept -> DenseBuffer& {
+    if(this != &in) {
+        A::deallocate(index);
+        capacitor = in.capacitor;
+        log       = in.log;
+        items     = std::move(in.items);
+        index     = in.index;
+
+        in.capacitor = 0;
+        in.log       = 0;
+        in.index     = nullptr;
+
+        // other load factor: rebuild index
+        if(LOAD_FACTOR != in.LOAD_FACTOR && capacitor && limit(capacitor) < items.size()) {
+            size_t size = capacitor << 1;
+            while(limit(size) < items.size()) {
+                size <<= 1;
+            }
+            rehash(size); // false: bad alloc, source index is still valid
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::push(T&& in) {
+    return insert(std::move(in));
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::push(const T& in) {
+    return insert(in);
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::pop(const T& in) noexcept {
+    size_t slot = probe(util::Hash<T>(in), [&in](const T& data) { return data == in; });
+    if(slot == NONE) {
+        return false; // not found
+    }
+    remove(slot);
+    return true;
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::exist(const T& in) const noexcept {
+    return probe(util::Hash<T>(in), [&in](const T& data) { return data == in; }) != NONE;
+}
+
+template<typename T, typename A>
+template<typename U> bool DenseBuffer<T, A>::insert(U&& in) {
+    hash_t hashed = util::Hash<T>(in);
+    // check
+    if(probe(hashed, [&in](const T& data) { return data == in; }) != NONE) {
+        return false;
+    }
+    return emplace(std::forward<U>(in), hashed);
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::erase(const Iterator<FWD>& in) noexcept {
+    if(in.self != this || in.index >= items.size()) {
+        return false; // exception
+    }
+    remove(owner(in.index));
+    return true;
+}
+
+template<typename T, typename A> size_t DenseBuffer<T, A>::size() const noexcept {
+    return items.size();
+}
+
+template<typename T, typename A> size_t DenseBuffer<T, A>::capacity() const noexcept {
+    return capacitor;
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::reserve(size_t in) noexcept {
+    size_t size = core::align(in < (size_t(1) << config::CAPACITY_LOG) ? (size_t(1) << config::CAPACITY_LOG) : in);
+    while(limit(size) < in) {
+        size <<= 1;
+    }
+    if(!items.reserve(in)) {
+        return false; // bad alloc
+    }
+    if(size <= capacitor) {
+        return true; // already allocated
+    }
+    return rehash(size);
+}
+
+template<typename T, typename A>
+template<typename W> bool DenseBuffer<T, A>::build(T* in, size_t n, W*) {
+    if(!reserve(items.size() + n)) {
+        return false; // bad alloc
+    }
+    for(size_t i = 0; i < n; ++i) {
+        insert(std::move(in[i])); // false: exist
+    }
+    return true;
+}
+
+template<typename T, typename A> void DenseBuffer<T, A>::clear() noexcept {
+    items.clear();
+    if(index) {
+        std::memset(index, 0xFF, sizeof(Index) * capacitor); // all EMPTY
+    }
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::find(const T& in) noexcept -> Iterator<FWD> {
+    size_t slot = probe(util::Hash<T>(in), [&in](const T& data) { return data == in; });
+    if(slot == NONE) {
+        return end(); // not found
+    }
+    return Iterator<FWD>(this, index[slot].pos);
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::at(size_t in) noexcept -> Iterator<FWD> {
+    if(in >= items.size()) {
+        return end(); // out of range
+    }
+    return Iterator<FWD>(this, in);
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::begin() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, 0);
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::end() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, items.size());
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::find(const T& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseBuffer*>(this)->find(in);
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseBuffer*>(this)->at(in);
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseBuffer*>(this)->begin();
+}
+
+template<typename T, typename A> auto DenseBuffer<T, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseBuffer*>(this)->end();
+}
+
+template<typename T, typename A>
+template<typename F> size_t DenseBuffer<T, A>::probe(hash_t hashed, F&& fn) const noexcept {
+    if(capacitor == 0) {
+        return NONE;
+    }
+
+    size_t   mask   = capacitor - 1;
+    uint32_t folded = tag(hashed);
+
+    // an empty always exists, see limit
+    for(size_t i = home(hashed);; i = (i + 1) & mask) {
+        const Index& it = index[i];
+        if(it.pos == EMPTY) {
+            return NONE; // end of probe sequence
+        }
+        if(it.tag == folded) {
+            const Slot& slot = items[it.pos];
+            if(slot.hash == hashed && fn(slot.data)) {
+                return i;
+            }
+        }
+    }
+}
+
+template<typename T, typename A> size_t DenseBuffer<T, A>::owner(size_t pos) const noexcept {
+    const T* data = &items[pos].data;
+    return probe(items[pos].hash, [data](const T& it) { return &it == data; }); // same address
+}
+
+template<typename T, typename A>
+template<typename U> bool DenseBuffer<T, A>::emplace(U&& in, hash_t hashed) {
+    size_t count = items.size();
+    if(count >= EMPTY) {
+        return false; // position limit
+    }
+    if(capacitor == 0 || count >= limit(capacitor)) {
+        if(!rehash(capacitor == 0 ? (size_t(1) << config::CAPACITY_LOG) : capacitor << 1)) {
+            return false; // bad alloc
+        }
+    }
+
+    // copy or move, can throw
+    if(!items.push(Slot{ T(std::forward<U>(in)), hashed })) {
+        return false; // bad alloc
+    }
+    place(hashed, uint32_t(count));
+    return true;
+}
+
+template<typename T, typename A> void DenseBuffer<T, A>::remove(size_t slot) {
+    size_t mask = capacitor - 1;
+    size_t pos  = index[slot].pos;
+
+    // backward shift: pull later entries of the cluster to the hole
+    size_t hole = slot;
+    for(size_t i = (hole + 1) & mask; index[i].pos != EMPTY; i = (i + 1) & mask) {
+        size_t start = home(items[index[i].pos].hash);
+        // move when home is not in (hole, i]
+        if(((i - start) & mask) >= ((i - hole) & mask)) {
+            index[hole] = index[i];
+            hole        = i;
+        }
+    }
+    index[hole].pos = EMPTY;
+
+    // shift items down, keep order
+    size_t last = items.size() - 1;
+    for(size_t i = pos; i < last; ++i) {
+        items[i] = std::move(items[i + 1]);
+    }
+    items.pop();
+
+    // positions after the removed one move by one
+    if(pos != last) {
+        for(size_t i = 0; i < capacitor; ++i) {
+            if(index[i].pos != EMPTY && index[i].pos > pos) {
+                --index[i].pos;
+            }
+        }
+    }
+}
+
+template<typename T, typename A> bool DenseBuffer<T, A>::rehash(size_t size) {
+    if(limit(size) < items.size()) {
+        return false; // shrink not allow
+    }
+
+    Index* newly = static_cast<Index*>(A::allocate(sizeof(Index) * size));
+    if(!newly) {
+        return false; // bad alloc
+    }
+    std::memset(newly, 0xFF, sizeof(Index) * size); // all EMPTY
+
+    A::deallocate(index);
+    index     = newly;
+    capacitor = size;
+
+    // update for fibonacci hash
+    log = 0;
+    while((size_t(1) << log) < size) {
+        ++log;
+    }
+
+    // rebuild from items, hash is stored
+    for(size_t i = 0; i < items.size(); ++i) {
+        place(items[i].hash, uint32_t(i));
+    }
+    return true;
+}
+
+template<typename T, typename A> void DenseBuffer<T, A>::place(hash_t hashed, uint32_t pos) noexcept {
+    size_t mask = capacitor - 1;
+    size_t i    = home(hashed);
+    while(index[i].pos != EMPTY) {
+        i = (i + 1) & mask;
+    }
+    index[i] = Index{ pos, tag(hashed) };
+}
+
+template<typename T, typename A> size_t DenseBuffer<T, A>::home(hash_t in) const noexcept {
+    return size_t((in * 11'400'714'819'323'198'485ull) >> (64 - log));
+}
+
+template<typename T, typename A> uint32_t DenseBuffer<T, A>::tag(hash_t in) noexcept {
+    return uint32_t(in ^ (in >> 32));
+}
+
+template<typename T, typename A> size_t DenseBuffer<T, A>::limit(size_t in) const noexcept {
+    float  factor = LOAD_FACTOR < 0.875f ? LOAD_FACTOR : 0.875f;
+    size_t out    = size_t(in * factor);
+    return out < in ? out : in - 1; // keep an empty
+}
+
+} // namespace container
+LWE_END
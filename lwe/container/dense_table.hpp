@@ -0,0 +1,91 @@
+#ifndef LWE_CONTAINER_DENSE_TABLE
+#define LWE_CONTAINER_DENSE_TABLE
+
+#include "../config/config.h"
+#include "iterator.hpp"
+#include "hash_table.hpp"
+#include "dense_buffer.hpp"
+
+LWE_BEGIN
+namespace container {
+
+//! @brief HashTable interface on DenseBuffer, hashed by key, iterated in insertion order
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename K, typename V, typename A = mem::System> class DenseTable {
+public:
+    using Entry = Record<K, V>;
+public:
+    CONTAINER_BODY(DenseBuffer, Entry, Entry, A);
+    using Allocator = A;
+private:
+    using DenseBuffer = DenseBuffer<Entry, A>;
+
+public:
+    //! @param [in] factor: load factor, max 0.875
+    DenseTable(float factor = config::LOADFACTOR);
+
+public:
+    V&       operator[](const K&);
+    const V& operator[](const K& in) const;
+
+public:
+    bool push(Entry&&);
+    bool push(const Entry&);
+    bool push(const K&, const V&);
+    bool push(K&&, V&&);
+    bool push(const K&, V&&);
+    bool push(K&&, const V&);
+
+public:
+    //! @note Q: K or any type hashed to the same util::Hash<K> and comparable to K (e.g. StringView for String)
+    template<typename Q = K> bool pop(const Q&);                          //!< pop
+    template<typename Q = K> bool pop(const Q&, hash_t);                  //!< pop, precomputed hash
+    template<typename Q = K> bool exist(const Q&) const noexcept;         //!< check key
+    template<typename Q = K> bool exist(const Q&, hash_t) const noexcept; //!< check key, precomputed hash
+
+public:
+    template<typename T> bool             insert(T&&);
+    template<typename T, typename U> bool insert(T&&, U&&);
+    bool                                  erase(const Iterator<FWD>&);
+
+public:
+    template<typename Q = K> Iterator<FWD> find(const Q&) noexcept;         //!< find by key
+    template<typename Q = K> Iterator<FWD> find(const Q&, hash_t) noexcept; //!< find by key, precomputed hash
+    Iterator<FWD>                          at(size_t) noexcept;
+    Iterator<FWD>                          begin() noexcept;
+    Iterator<FWD>                          end() noexcept;
+
+public:
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&) const noexcept;
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&, hash_t) const noexcept;
+    Iterator<FWD | VIEW>                          at(size_t) const noexcept;
+    Iterator<FWD | VIEW>                          begin() const noexcept;
+    Iterator<FWD | VIEW>                          end() const noexcept;
+
+public:
+    template<typename Q = K> static hash_t hashof(const Q&); //!< key hash, same as stored
+
+public:
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+    bool   reserve(size_t) noexcept;
+    void   clear() noexcept;
+
+public:
+    //! @brief bulk build, sizes the table once, see DenseBuffer::build
+    template<typename W = async::Worker> bool build(Entry*, size_t, W* = nullptr);
+
+private:
+    template<typename Q> size_t slot(hash_t, const Q&) const noexcept; //!< get index slot, DenseBuffer::NONE: not found
+
+private:
+    template<typename T> bool emplace(T&&);
+
+public:
+    DenseBuffer set;
+};
+
+} // namespace container
+LWE_END
+#include "dense_table.ipp"
+#endif
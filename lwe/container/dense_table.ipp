@@ -0,0 +1,190 @@
+LWE_BEGIN
+namespace container {
+
+template<typename K, typename V, typename A> DenseTable<K, V, A>::DenseTable(float factor): set(factor) { }
+
+template<typename K, typename V, typename A> V& DenseTable<K, V, A>::operator[](const K& in) {
+    hash_t hashed = util::Hash<K>(in);
+
+    size_t index = slot(hashed, in);
+    if(index == DenseBuffer::NONE) {
+        // insert and return
+        // empty data for call constructor
+        if(!set.emplace(Entry{ in, V{} }, hashed)) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+        index = slot(hashed, in);
+    }
+    return set.items[set.index[index].pos].data.second;
+}
+
+template<typename K, typename V, typename A> const V& DenseTable<K, V, A>::operator[](const K& in) const {
+    return const_cast<DenseTable*>(this)->operator[](in);
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::push(Entry&& in) {
+    return insert(std::move(in));
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::push(const Entry& in) {
+    return insert(in);
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::push(const K& k, const V& v) {
+    return insert(Entry{ k, v });
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::push(K&& k, V&& v) {
+    return insert(Entry{ std::move(k), std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::push(const K& k, V&& v) {
+    return insert(Entry{ k, std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::push(K&& k, const V& v) {
+    return insert(Entry{ std::move(k), v });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool DenseTable<K, V, A>::pop(const Q& in) {
+    return pop(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool DenseTable<K, V, A>::pop(const Q& in, hash_t hashed) {
+    size_t index = slot(hashed, in);
+
+    // not found
+    if(index == DenseBuffer::NONE) {
+        return false;
+    }
+    set.remove(index);
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool DenseTable<K, V, A>::exist(const Q& in) const noexcept {
+    return exist(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool DenseTable<K, V, A>::exist(const Q& in, hash_t hashed) const noexcept {
+    return slot(hashed, in) != DenseBuffer::NONE;
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::erase(const Iterator<FWD>& in) {
+    return set.erase(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool DenseTable<K, V, A>::insert(T&& in) {
+    return emplace(std::forward<T>(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool DenseTable<K, V, A>::insert(T&& k, U&& v) {
+    return emplace(Entry{ std::forward<T>(k), std::forward<U>(v) });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto DenseTable<K, V, A>::find(const Q& in) noexcept -> Iterator<FWD> {
+    return find(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto DenseTable<K, V, A>::find(const Q& in, hash_t hashed) noexcept -> Iterator<FWD> {
+    size_t index = slot(hashed, in);
+    if(index == DenseBuffer::NONE) {
+        return end(); // not found
+    }
+    return Iterator<FWD>(&set, set.index[index].pos);
+}
+
+template<typename K, typename V, typename A> auto DenseTable<K, V, A>::at(size_t in) noexcept -> Iterator<FWD> {
+    return set.at(in);
+}
+
+template<typename K, typename V, typename A> auto DenseTable<K, V, A>::begin() noexcept -> Iterator<FWD> {
+    return set.begin();
+}
+
+template<typename K, typename V, typename A> auto DenseTable<K, V, A>::end() noexcept -> Iterator<FWD> {
+    return set.end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto DenseTable<K, V, A>::find(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseTable*>(this)->find(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto DenseTable<K, V, A>::find(const Q& in, hash_t hashed) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseTable*>(this)->find(in, hashed);
+}
+
+template<typename K, typename V, typename A>
+auto DenseTable<K, V, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseTable*>(this)->at(in);
+}
+
+template<typename K, typename V, typename A>
+auto DenseTable<K, V, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseTable*>(this)->begin();
+}
+
+template<typename K, typename V, typename A>
+auto DenseTable<K, V, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<DenseTable*>(this)->end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> hash_t DenseTable<K, V, A>::hashof(const Q& in) {
+    return util::Hash<K>(in);
+}
+
+template<typename K, typename V, typename A> size_t DenseTable<K, V, A>::size() const noexcept {
+    return set.items.size();
+}
+
+template<typename K, typename V, typename A> size_t DenseTable<K, V, A>::capacity() const noexcept {
+    return set.capacitor;
+}
+
+template<typename K, typename V, typename A> bool DenseTable<K, V, A>::reserve(size_t in) noexcept {
+    return set.reserve(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename W> bool DenseTable<K, V, A>::build(Entry* in, size_t n, W*) {
+    if(!reserve(size() + n)) {
+        return false; // bad alloc
+    }
+    for(size_t i = 0; i < n; ++i) {
+        insert(std::move(in[i])); // false: exist
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A> void DenseTable<K, V, A>::clear() noexcept {
+    set.clear();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> size_t DenseTable<K, V, A>::slot(hash_t in, const Q& key) const noexcept {
+    return set.probe(in, [&key](const Entry& data) { return data.first == key; }); // key only
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool DenseTable<K, V, A>::emplace(T&& in) {
+    hash_t hashed = util::Hash<K>(in.first); // first only
+
+    // check collide
+    if(slot(hashed, in.first) != DenseBuffer::NONE) {
+        return false;
+    }
+    return set.emplace(std::forward<T>(in), hashed);
+}
+
+} // namespace container
+LWE_END
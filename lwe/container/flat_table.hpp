@@ -0,0 +1,114 @@
+/**************************************************************************************************
+ * FLAT MAP (sorted entries in a LinearBuffer)
+ *
+ * memory layout
+ *   items (LinearBuffer)
+ *   +-------+-------+-------+-------+-- ... --+
+ *   | k0,v0 | k1,v1 | k2,v2 | k3,v3 |         |  < sorted by key, k0 < k1 < k2 < k3
+ *   +-------+-------+-------+-------+-- ... --+
+ *
+ * - find   : binary search on one array, no node chasing
+ * - iterate: linear scan, at(i) is O(1)
+ * - insert : later entries shift right (O(n)), the greatest key is appended (O(1))
+ * - erase  : later entries shift left (O(n))
+ * - build  : append all and sort once, for unsorted bulk data
+ * - shift  : relocatable entries (core::Relocatable) by one memmove
+ *
+ * NOTE: for read-mostly data, TreeTable for many random writes.
+ * NOTE: keys are compared by operator<, Q of lookup needs Q < K and K < Q.
+ **************************************************************************************************/
+
+#ifndef LWE_CONTAINER_FLAT_TABLE
+#define LWE_CONTAINER_FLAT_TABLE
+
+#include "../config/config.h"
+#include "iterator.hpp"
+#include "hash_table.hpp"
+#include "linear_buffer.hpp"
+#include <algorithm>
+
+LWE_BEGIN
+namespace container {
+
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename K, typename V, typename A = mem::System> class FlatTable {
+public:
+    using Entry = Record<K, V>;
+public:
+    CONTAINER_BODY(LinearBuffer, Entry, Entry, 0, A);
+    using Allocator = A;
+private:
+    using LinearBuffer = LinearBuffer<Entry, 0, A>;
+
+public:
+    V&       operator[](const K&);
+    const V& operator[](const K& in) const;
+
+public:
+    bool push(Entry&&);
+    bool push(const Entry&);
+    bool push(const K&, const V&);
+    bool push(K&&, V&&);
+    bool push(const K&, V&&);
+    bool push(K&&, const V&);
+
+public:
+    //! @note Q: K or any type ordered with K by operator< both ways (e.g. StringView for String)
+    template<typename Q = K> bool pop(const Q&);                  //!< pop
+    template<typename Q = K> bool exist(const Q&) const noexcept; //!< check key
+
+public:
+    template<typename T> bool             insert(T&&);
+    template<typename T, typename U> bool insert(T&&, U&&);
+    bool                                  erase(const Iterator<FWD>&);
+
+public:
+    template<typename Q = K> Iterator<FWD> find(const Q&) noexcept;        //!< find by key
+    template<typename Q = K> Iterator<FWD> lower_bound(const Q&) noexcept; //!< first key not less than
+    template<typename Q = K> Iterator<FWD> upper_bound(const Q&) noexcept; //!< first key greater than
+    Iterator<FWD>                          at(size_t) noexcept;            //!< find by order, O(1)
+    Iterator<FWD>                          begin() noexcept;
+    Iterator<FWD>                          end() noexcept;
+
+public:
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&) const noexcept;
+    template<typename Q = K> Iterator<FWD | VIEW> lower_bound(const Q&) const noexcept;
+    template<typename Q = K> Iterator<FWD | VIEW> upper_bound(const Q&) const noexcept;
+    Iterator<FWD | VIEW>                          at(size_t) const noexcept;
+    Iterator<FWD | VIEW>                          begin() const noexcept;
+    Iterator<FWD | VIEW>                          end() const noexcept;
+
+public:
+    //! @brief visit entries of key in [from, to) in order, F: void(const Entry&)
+    //! @return visited count
+    template<typename Q, typename F> size_t scan(const Q&, const Q&, F&&) const;
+
+public:
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+    bool   reserve(size_t) noexcept;
+    void   clear() noexcept;
+
+public:
+    //! @brief bulk build, append all and sort once, existing and first of equal keys are kept
+    //! @param [in] in: entry array, moved out
+    //! @param [in] n: entry count
+    //! @param [in] worker: unused, sorted in caller thread
+    //! @return false: bad alloc
+    template<typename W = async::Worker> bool build(Entry*, size_t, W* = nullptr);
+
+private:
+    template<typename Q> size_t search(const Q&) const noexcept; //!< first index of key not less than
+    static void                 shift(Entry*, size_t, size_t);  //!< move item from to, keep order of between
+
+private:
+    template<typename T> bool emplace(T&&);
+
+public:
+    LinearBuffer items;
+};
+
+} // namespace container
+LWE_END
+#include "flat_table.ipp"
+#endif
@@ -0,0 +1,255 @@
+LWE_BEGIN
+namespace container {
+
+template<typename K, typename V, typename A> V& FlatTable<K, V, A>::operator[](const K& in) {
+    size_t pos = search(in);
+    if(pos == items.size() || in < items[pos].first) {
+        // insert and return
+        // empty data for call constructor
+        if(!emplace(Entry{ in, V{} })) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+    }
+    return items[pos].second;
+}
+
+template<typename K, typename V, typename A> const V& FlatTable<K, V, A>::operator[](const K& in) const {
+    return const_cast<FlatTable*>(this)->operator[](in);
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::push(Entry&& in) {
+    return insert(std::move(in));
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::push(const Entry& in) {
+    return insert(in);
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::push(const K& k, const V& v) {
+    return insert(Entry{ k, v });
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::push(K&& k, V&& v) {
+    return insert(Entry{ std::move(k), std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::push(const K& k, V&& v) {
+    return insert(Entry{ k, std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::push(K&& k, const V& v) {
+    return insert(Entry{ std::move(k), v });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool FlatTable<K, V, A>::pop(const Q& in) {
+    size_t pos = search(in);
+    if(pos == items.size() || in < items[pos].first) {
+        return false; // not found
+    }
+
+    // shift left, keep order, popped at the end
+    shift(items.data(), pos, items.size() - 1);
+    items.pop();
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool FlatTable<K, V, A>::exist(const Q& in) const noexcept {
+    size_t pos = search(in);
+    return pos != items.size() && !(in < items[pos].first);
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::erase(const Iterator<FWD>& in) {
+    size_t pos = &*in - items.data();
+    if(pos >= items.size()) {
+        return false; // exception
+    }
+    return pop(items[pos].first);
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool FlatTable<K, V, A>::insert(T&& in) {
+    return emplace(std::forward<T>(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool FlatTable<K, V, A>::insert(T&& k, U&& v) {
+    return emplace(Entry{ std::forward<T>(k), std::forward<U>(v) });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto FlatTable<K, V, A>::find(const Q& in) noexcept -> Iterator<FWD> {
+    size_t pos = search(in);
+    if(pos == items.size() || in < items[pos].first) {
+        return end(); // not found
+    }
+    return Iterator<FWD>(items.data() + pos);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto FlatTable<K, V, A>::lower_bound(const Q& in) noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(items.data() + search(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto FlatTable<K, V, A>::upper_bound(const Q& in) noexcept -> Iterator<FWD> {
+    size_t pos = search(in);
+    if(pos != items.size() && !(in < items[pos].first)) {
+        ++pos; // unique keys, equal is one
+    }
+    return Iterator<FWD>(items.data() + pos);
+}
+
+template<typename K, typename V, typename A> auto FlatTable<K, V, A>::at(size_t in) noexcept -> Iterator<FWD> {
+    if(in >= items.size()) {
+        return end(); // out of range
+    }
+    return Iterator<FWD>(items.data() + in);
+}
+
+template<typename K, typename V, typename A> auto FlatTable<K, V, A>::begin() noexcept -> Iterator<FWD> {
+    return items.begin();
+}
+
+template<typename K, typename V, typename A> auto FlatTable<K, V, A>::end() noexcept -> Iterator<FWD> {
+    return items.end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto FlatTable<K, V, A>::find(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<FlatTable*>(this)->find(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto FlatTable<K, V, A>::lower_bound(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<FlatTable*>(this)->lower_bound(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto FlatTable<K, V, A>::upper_bound(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<FlatTable*>(this)->upper_bound(in);
+}
+
+template<typename K, typename V, typename A>
+auto FlatTable<K, V, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<FlatTable*>(this)->at(in);
+}
+
+template<typename K, typename V, typename A> auto FlatTable<K, V, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<FlatTable*>(this)->begin();
+}
+
+template<typename K, typename V, typename A> auto FlatTable<K, V, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<FlatTable*>(this)->end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q, typename F> size_t FlatTable<K, V, A>::scan(const Q& from, const Q& to, F&& fn) const {
+    size_t loop = items.size();
+    size_t pos  = search(from);
+    size_t cnt  = 0;
+    for(; pos < loop && items[pos].first < to; ++pos, ++cnt) {
+        fn(items[pos]);
+    }
+    return cnt;
+}
+
+template<typename K, typename V, typename A> size_t FlatTable<K, V, A>::size() const noexcept {
+    return items.size();
+}
+
+template<typename K, typename V, typename A> size_t FlatTable<K, V, A>::capacity() const noexcept {
+    return items.capacity();
+}
+
+template<typename K, typename V, typename A> bool FlatTable<K, V, A>::reserve(size_t in) noexcept {
+    return items.reserve(in);
+}
+
+template<typename K, typename V, typename A> void FlatTable<K, V, A>::clear() noexcept {
+    items.clear();
+}
+
+template<typename K, typename V, typename A>
+template<typename W> bool FlatTable<K, V, A>::build(Entry* in, size_t n, W*) {
+    size_t old = items.size();
+    if(!items.reserve(old + n)) {
+        return false; // bad alloc
+    }
+    for(size_t i = 0; i < n; ++i) {
+        items.push(std::move(in[i]));
+    }
+
+    // stable: existing entries, then input order for equal keys
+    Entry* data = items.data();
+    std::stable_sort(data, data + items.size(), [](const Entry& l, const Entry& r) { return l.first < r.first; });
+
+    // unique, first of equal keys is kept
+    size_t loop = items.size();
+    size_t last = 0;
+    for(size_t i = 1; i < loop; ++i) {
+        if(data[last].first < data[i].first) {
+            if(++last != i) {
+                data[last] = std::move(data[i]);
+            }
+        }
+    }
+    while(items.size() > last + 1) {
+        items.pop();
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> size_t FlatTable<K, V, A>::search(const Q& key) const noexcept {
+    const Entry* data = items.data();
+    size_t       lo   = 0;
+    size_t       hi   = items.size();
+    while(lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        if(data[mid].first < key) {
+            lo = mid + 1;
+        }
+        else hi = mid;
+    }
+    return lo;
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool FlatTable<K, V, A>::emplace(T&& in) {
+    size_t pos = search(in.first);
+    if(pos != items.size() && !(in.first < items[pos].first)) {
+        return false; // exist
+    }
+    if(!items.push(std::forward<T>(in))) {
+        return false; // bad alloc
+    }
+
+    // greatest key: already in place
+    shift(items.data(), items.size() - 1, pos);
+    return true;
+}
+
+template<typename K, typename V, typename A> void FlatTable<K, V, A>::shift(Entry* data, size_t from, size_t to) {
+    if(from == to) {
+        return;
+    }
+
+    if constexpr(Relocatable<Entry>::value) {
+        alignas(Entry) unsigned char temp[sizeof(Entry)]; // raw bytes of item
+        std::memcpy(temp, data + from, sizeof(Entry));
+        if(from < to) {
+            std::memmove(data + from, data + from + 1, (to - from) * sizeof(Entry));
+        }
+        else std::memmove(data + to + 1, data + to, (from - to) * sizeof(Entry));
+        std::memcpy(data + to, temp, sizeof(Entry));
+    }
+    else if(from < to) {
+        std::rotate(data + from, data + from + 1, data + to + 1);
+    }
+    else std::rotate(data + to, data + from, data + from + 1);
+}
+
+} // namespace container
+LWE_END
@@ -0,0 +1,51 @@
+#ifndef LWE_CONTAINER_HASH_BACKEND
+#define LWE_CONTAINER_HASH_BACKEND
+
+#include "hashed_buffer.hpp"
+#include "hash_table.hpp"
+#include "swiss_buffer.hpp"
+#include "swiss_table.hpp"
+#include "dense_buffer.hpp"
+#include "dense_table.hpp"
+
+/**************************************************************************************************
+ * hash container backend selector
+ *
+ *  Chaining: HashedBuffer / HashTable, bucket with inline first element + chain array, default
+ *  Probing : SwissBuffer  / SwissTable, open addressing, 1 byte control, 16 slots per probe
+ *  Ordered : DenseBuffer  / DenseTable, dense items in insertion order + position index,
+ *            O(1) at(i), iteration and encoding in insertion order (deterministic output)
+ *
+ * e.g.
+ *  stl::Set<int, mem::System, container::Probing>        set;
+ *  stl::Map<String, int, mem::Heap, container::Probing>   map;
+ *  stl::Map<String, int, mem::System, container::Ordered> save; // stable save order
+ **************************************************************************************************/
+
+LWE_BEGIN
+namespace container {
+
+//! @brief separate chaining backend
+struct Chaining {
+    template<typename T, typename A> using Set             = HashedBuffer<T, A>;
+    template<typename K, typename V, typename A> using Map = HashTable<K, V, A>;
+};
+
+//! @brief open addressing backend
+struct Probing {
+    template<typename T, typename A> using Set             = SwissBuffer<T, A>;
+    template<typename K, typename V, typename A> using Map = SwissTable<K, V, A>;
+};
+
+//! @brief insertion ordered dense backend
+struct Ordered {
+    template<typename T, typename A> using Set             = DenseBuffer<T, A>;
+    template<typename K, typename V, typename A> using Map = DenseTable<K, V, A>;
+};
+
+template<typename T, typename A, typename B> using HashSet             = typename B::template Set<T, A>;
+template<typename K, typename V, typename A, typename B> using HashMap = typename B::template Map<K, V, A>;
+
+} // namespace container
+LWE_END
+#endif
@@ -3,12 +3,11 @@
 
 #include "../config/config.h"
 #include "iterator.hpp"
+#include "hashed_buffer.hpp"
 
 LWE_BEGIN
 namespace container {
 
-template<typename> class HashedBuffer;
-
 template<typename K, typename V>
 struct Record: public std::pair<K, V> {
     using std::pair<K, V>::pair;
@@ -17,13 +16,23 @@ struct Record: public std::pair<K, V> {
     bool operator!=(const std::pair<K, V>& in) const { return this->first != in.first; }
 };
 
-template<typename K, typename V> class HashTable {
+} // namespace container
+
+// same layout as std::pair
+template<typename K, typename V>
+struct core::Relocatable<container::Record<K, V>>: core::Relocatable<std::pair<K, V>> { };
+
+namespace container {
+
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename K, typename V, typename A = mem::System> class HashTable {
 public:
     using Entry = Record<K, V>;
 public:
-    CONTAINER_BODY(HashedBuffer, Entry, Entry);
+    CONTAINER_BODY(HashedBuffer, Entry, Entry, A);
+    using Allocator = A;
 private:
-    using HashedBuffer = HashedBuffer<Entry>;
+    using HashedBuffer = HashedBuffer<Entry, A>;
     using Bucket       = typename HashedBuffer::Bucket;
     using Chain        = typename HashedBuffer::Chain;
 
@@ -38,8 +47,13 @@ public:
     bool push(K&&, V&&);
     bool push(const K&, V&&);
     bool push(K&&, const V&);
-    bool pop(const K&);
-    bool exist(const K&) const noexcept;
+
+public:
+    //! @note Q: K or any type hashed to the same util::Hash<K> and comparable to K (e.g. StringView for String)
+    template<typename Q = K> bool pop(const Q&);                          //!< pop
+    template<typename Q = K> bool pop(const Q&, hash_t);                  //!< pop, precomputed hash
+    template<typename Q = K> bool exist(const Q&) const noexcept;         //!< check key
+    template<typename Q = K> bool exist(const Q&, hash_t) const noexcept; //!< check key, precomputed hash
 
 public:
     template<typename T> bool             insert(T&&);
@@ -47,22 +61,48 @@ public:
     bool                                  erase(const Iterator<FWD>&);
 
 public:
-    Iterator<FWD> find(const K&) noexcept;
-    Iterator<FWD> at(size_t) noexcept;
-    Iterator<FWD> begin() noexcept;
-    Iterator<FWD> end() noexcept;
+    template<typename Q = K> Iterator<FWD> find(const Q&) noexcept;         //!< find by key
+    template<typename Q = K> Iterator<FWD> find(const Q&, hash_t) noexcept; //!< find by key, precomputed hash
+    Iterator<FWD>                          at(size_t) noexcept;
+    Iterator<FWD>                          begin() noexcept;
+    Iterator<FWD>                          end() noexcept;
+
+public:
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&) const noexcept;
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&, hash_t) const noexcept;
+    Iterator<FWD | VIEW>                          at(size_t) const noexcept;
+    Iterator<FWD | VIEW>                          begin() const noexcept;
+    Iterator<FWD | VIEW>                          end() const noexcept;
+
+public:
+    //! @brief batched find, bucket loads overlap
+    //! @param [in] in: key array
+    //! @param [in] n: key count
+    //! @param [out] out: iterator array, end() when not found
+    template<typename Q = K> void find_many(const Q*, size_t, Iterator<FWD>*) noexcept;
+
+    //! @brief batched exist, bucket loads overlap
+    //! @param [in] in: key array
+    //! @param [in] n: key count
+    //! @param [out] out: bool array, nullable
+    //! @return found count
+    template<typename Q = K> size_t exist_many(const Q*, size_t, bool* = nullptr) const noexcept;
 
 public:
-    Iterator<FWD | VIEW> find(const K&) const noexcept;
-    Iterator<FWD | VIEW> at(size_t) const noexcept;
-    Iterator<FWD | VIEW> begin() const noexcept;
-    Iterator<FWD | VIEW> end() const noexcept;
+    //! @brief bulk build, sizes the table once, see HashedBuffer::build
+    //! @param [in] in: entry array, moved out when inserted
+    //! @param [in] n: entry count
+    //! @param [in] worker: async::Worker, nullptr: build on this thread
+    //! @return false: bad alloc
+    template<typename W = async::Worker> bool build(Entry*, size_t, W* = nullptr);
 
 public:
-    size_t indexof(hash_t) const noexcept;
+    template<typename Q = K> static hash_t hashof(const Q&); //!< key hash, same as stored
+    size_t                                 indexof(hash_t) const noexcept;
     size_t size() const noexcept;
     size_t capacity() const noexcept;
     bool   reserve(size_t) noexcept;
+    void   incremental(size_t) noexcept; //!< buckets migrated per insert / erase, 0: rehash at once
 
 public:
     const Bucket* bucket(size_t) const noexcept; //!< get bucket(index)
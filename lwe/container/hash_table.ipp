@@ -4,7 +4,7 @@
 LWE_BEGIN
 namespace container {
 
-template<typename K, typename V> V& HashTable<K, V>::operator[](const K& in) {
+template<typename K, typename V, typename A> V& HashTable<K, V, A>::operator[](const K& in) {
     hash_t hashed = util::Hash<K>(in);
 
     Chain* pos = slot(hashed, in);
@@ -19,38 +19,43 @@ template<typename K, typename V> V& HashTable<K, V>::operator[](const K& in) {
     else return pos->data.second;
 }
 
-template<typename K, typename V> const V& HashTable<K, V>::operator[](const K& in) const {
+template<typename K, typename V, typename A> const V& HashTable<K, V, A>::operator[](const K& in) const {
     return const_cast<HashTable*>(this)->operator[](in);
 }
 
-template<typename K, typename V> bool HashTable<K, V>::push(Entry&& in) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::push(Entry&& in) {
     return insert(std::move(in));
 }
 
-template<typename K, typename V> bool HashTable<K, V>::push(const Entry& in) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::push(const Entry& in) {
     return insert(in);
 }
 
-template<typename K, typename V> bool HashTable<K, V>::push(const K& K, const V& V) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::push(const K& K, const V& V) {
     return insert(Entry{ K, V });
 }
 
-template<typename K, typename V> bool HashTable<K, V>::push(K&& K, V&& V) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::push(K&& K, V&& V) {
     return insert(Entry{ std::move(K), std::move(V) });
 }
 
-template<typename K, typename V> bool HashTable<K, V>::push(const K& K, V&& V) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::push(const K& K, V&& V) {
     return insert(Entry{ K, std::move(V) });
 }
 
-template<typename K, typename V> bool HashTable<K, V>::push(K&& K, const V& V) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::push(K&& K, const V& V) {
     return insert(Entry{ std::move(K), V });
 }
 
-template<typename K, typename V> bool HashTable<K, V>::pop(const K& in) {
-    hash_t  hashed = util::Hash<K>(in);
-    Bucket* bucket = slot(hashed);
-    Chain*  pos    = slot(hashed, in);
+template<typename K, typename V, typename A>
+template<typename Q> bool HashTable<K, V, A>::pop(const Q& in) {
+    return pop(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool HashTable<K, V, A>::pop(const Q& in, hash_t hashed) {
+    Bucket* bucket = nullptr; // owner
+    Chain*  pos    = set.locate(hashed, [&in](const Entry& data) { return data.first == in; }, &bucket);
 
     // not found
     if(pos == nullptr) {
@@ -60,146 +65,183 @@ template<typename K, typename V> bool HashTable<K, V>::pop(const K& in) {
     return true;
 }
 
-template<typename K, typename V> bool HashTable<K, V>::exist(const K& in) const noexcept {
-    return slot(util::Hash<K>(in), in) != nullptr;
+template<typename K, typename V, typename A>
+template<typename Q> bool HashTable<K, V, A>::exist(const Q& in) const noexcept {
+    return exist(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool HashTable<K, V, A>::exist(const Q& in, hash_t hashed) const noexcept {
+    return set.locate(hashed, [&in](const Entry& data) { return data.first == in; }) != nullptr;
 }
 
-template<typename K, typename V> bool HashTable<K, V>::erase(const Iterator<FWD>& in) {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::erase(const Iterator<FWD>& in) {
     if(in != end()) {
         return set.pop(*in);
     }
     return false;
 }
 
-template<typename K, typename V>
-template<typename T> bool HashTable<K, V>::insert(T&& in) {
+template<typename K, typename V, typename A>
+template<typename T> bool HashTable<K, V, A>::insert(T&& in) {
     return emplace(std::forward<T>(in));
 }
 
-template<typename K, typename V>
-template<typename T, typename U> bool HashTable<K, V>::insert(T&& k, U&& v) {
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool HashTable<K, V, A>::insert(T&& k, U&& v) {
     return emplace(Entry{ std::forward<T>(k), std::forward<U>(v) });
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::find(const K& in) noexcept -> Iterator<FWD> {
-    if(set.buckets == nullptr) {
-        return end();
-    }
+template<typename K, typename V, typename A>
+template<typename Q> auto HashTable<K, V, A>::find(const Q& in) noexcept -> Iterator<FWD> {
+    return find(in, hashof(in));
+}
 
+template<typename K, typename V, typename A>
+template<typename Q> auto HashTable<K, V, A>::find(const Q& in, hash_t hashed) noexcept -> Iterator<FWD> {
     // avoiding unnecessary copy logic
-    hash_t  hashed = util::Hash<K>(in);
-    size_t  index  = set.indexof(hashed);
-    Bucket& bucket = set.buckets[index];
-
-    // found
-    if(bucket.used) {
-        // not chain, or first data
-        if(bucket.hash == hashed && bucket.data.first == in) {
-            Iterator<FWD> it = { &set, index }; // create iterator
-            return it;
-        }
-        // has chain
-        for(uint16_t i = 0; i < bucket.size; ++i) {
-            Chain& chain = bucket.chain[i];
-            if(hashed == chain.hash && in == chain.data.first) {
-                Iterator<FWD> it = { &set, index, i }; // create iterator
-                return it;
-            }
-        }
+    Bucket* bucket = nullptr;
+    size_t  index  = 0;
+    Chain*  chain  = set.locate(hashed, [&in](const Entry& data) { return data.first == in; }, &bucket, &index);
+
+    if(chain == nullptr) {
+        return set.end(); // not found
     }
-    return set.end(); // not found
+    // not chain, or first data
+    if(chain == bucket) {
+        Iterator<FWD> it = { &set, index }; // create iterator
+        return it;
+    }
+    Iterator<FWD> it = { &set, index, uint16_t(chain - bucket->chain) }; // create iterator
+    return it;
 }
 
-template<typename K, typename V> auto HashTable<K, V>::at(size_t in) noexcept -> Iterator<FWD> {
+template<typename K, typename V, typename A> auto HashTable<K, V, A>::at(size_t in) noexcept -> Iterator<FWD> {
     return set.at(in);
 }
 
-template<typename K, typename V> auto HashTable<K, V>::begin() noexcept -> Iterator<FWD> {
+template<typename K, typename V, typename A> auto HashTable<K, V, A>::begin() noexcept -> Iterator<FWD> {
     return set.begin();
 }
 
-template<typename K, typename V> auto HashTable<K, V>::end() noexcept -> Iterator<FWD> {
+template<typename K, typename V, typename A> auto HashTable<K, V, A>::end() noexcept -> Iterator<FWD> {
     return set.end();
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::find(const K& in) const noexcept -> Iterator<FWD | VIEW> {
+template<typename K, typename V, typename A>
+template<typename Q> auto HashTable<K, V, A>::find(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashTable*>(this)->find(in);
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+template<typename K, typename V, typename A>
+template<typename Q> auto HashTable<K, V, A>::find(const Q& in, hash_t hashed) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<HashTable*>(this)->find(in, hashed);
+}
+
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashTable*>(this)->at(in);
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::begin() const noexcept -> Iterator<FWD | VIEW> {
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashTable*>(this)->begin();
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::end() const noexcept -> Iterator<FWD | VIEW> {
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::end() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashTable*>(this)->end();
 }
 
-template<typename K, typename V> size_t HashTable<K, V>::indexof(hash_t in) const noexcept {
+template<typename K, typename V, typename A>
+template<typename Q> void HashTable<K, V, A>::find_many(const Q* in, size_t n, Iterator<FWD>* out) noexcept {
+    set.batch(
+        in, n, [](const Q& key) { return hashof(key); }, [](const Entry& data, const Q& key) { return data.first == key; },
+        [this, out](size_t nth, Chain* found, Bucket* bucket, size_t index) {
+            if(found == nullptr) {
+                out[nth] = set.end(); // not found
+            }
+            else if(found == bucket) {
+                out[nth] = Iterator<FWD>{ &set, index }; // not chain, or first data
+            }
+            else out[nth] = Iterator<FWD>{ &set, index, uint16_t(found - bucket->chain) }; // chain
+        });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> size_t HashTable<K, V, A>::exist_many(const Q* in, size_t n, bool* out) const noexcept {
+    size_t total = 0;
+    set.batch(
+        in, n, [](const Q& key) { return hashof(key); }, [](const Entry& data, const Q& key) { return data.first == key; },
+        [&total, out](size_t nth, Chain* found, Bucket*, size_t) {
+            if(out) out[nth] = found != nullptr;
+            total += found != nullptr;
+        });
+    return total;
+}
+
+template<typename K, typename V, typename A>
+template<typename W> bool HashTable<K, V, A>::build(Entry* in, size_t n, W* worker) {
+    return set.assemble(
+        in, n, worker, [](const Entry& data) { return hashof(data.first); },
+        [](const Entry& data, const Entry& key) { return data.first == key.first; });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> hash_t HashTable<K, V, A>::hashof(const Q& in) {
+    return util::Hash<K>(in);
+}
+
+template<typename K, typename V, typename A> size_t HashTable<K, V, A>::indexof(hash_t in) const noexcept {
     return set.indexof(in);
 }
 
-template<typename K, typename V> size_t HashTable<K, V>::size() const noexcept {
+template<typename K, typename V, typename A> size_t HashTable<K, V, A>::size() const noexcept {
     return set.counter;
 }
 
-template<typename K, typename V> size_t HashTable<K, V>::capacity() const noexcept {
+template<typename K, typename V, typename A> size_t HashTable<K, V, A>::capacity() const noexcept {
     return set.capacitor;
 }
 
-template<typename K, typename V> bool HashTable<K, V>::reserve(size_t in) noexcept {
+template<typename K, typename V, typename A> bool HashTable<K, V, A>::reserve(size_t in) noexcept {
     return set.reserve(in);
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::bucket(size_t in) const noexcept -> const Bucket* {
+template<typename K, typename V, typename A> void HashTable<K, V, A>::incremental(size_t in) noexcept {
+    set.incremental(in);
+}
+
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::bucket(size_t in) const noexcept -> const Bucket* {
     return set.bucket(in);
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::slot(hash_t in) noexcept -> Bucket* {
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::slot(hash_t in) noexcept -> Bucket* {
     return set.slot(in);
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::slot(hash_t in, const K& data) noexcept -> Chain* {
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::slot(hash_t in, const K& data) noexcept -> Chain* {
     if(set.capacitor == 0) {
         set.rehash(set.log); // init
     }
-    Bucket* bucket = set.buckets + (set.indexof(in));
-
-    if(bucket->hash == in && bucket->data.first == data) {
-        return bucket;
-    }
-    for(uint16_t i = 0; i < bucket->size; ++i) {
-        Chain* chain = bucket->chain + i;
-        if(chain->hash == in && chain->data.first == data) {
-            return chain;
-        }
-    }
-    return nullptr;
+    return set.locate(in, [&data](const Entry& it) { return it.first == data; });
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::slot(hash_t in) const noexcept -> const Bucket* {
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::slot(hash_t in) const noexcept -> const Bucket* {
     return const_cast<HashTable*>(this)->slot(in);
 }
 
-template<typename K, typename V>
-auto HashTable<K, V>::slot(hash_t in, const K& data) const noexcept -> const Chain* {
+template<typename K, typename V, typename A>
+auto HashTable<K, V, A>::slot(hash_t in, const K& data) const noexcept -> const Chain* {
     return const_cast<HashTable*>(this)->slot(in, data);
 }
 
-template<typename K, typename V>
-template<typename T> bool HashTable<K, V>::emplace(T&& in) {
+template<typename K, typename V, typename A>
+template<typename T> bool HashTable<K, V, A>::emplace(T&& in) {
     hash_t hashed = util::Hash<K>(in.first); // first only
 
     // check collide
@@ -208,12 +250,10 @@ template<typename T> bool HashTable<K, V>::emplace(T&& in) {
     }
 
     // check size
-    if(set.counter >= set.factor) {
-        if(!set.rehash(set.log + 1)) {
-            return false;
-        }
+    if(!set.grow()) {
+        return false;
     }
-    return set.emplace(in, hashed);
+    return set.emplace(std::forward<T>(in), hashed);
 }
 
 } // namespace container
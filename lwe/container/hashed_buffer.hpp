@@ -29,6 +29,39 @@
  *  bucket.used == true  -> exist
  *  bucket.size == 0     -> no chain
  *  bucket.size >= 0     -> chaining
+ *
+ * incremental rehash (step > 0)
+ *   buckets                      olds
+ *   +---+---+---+---+-- ... --+   +---+---+---+-- ... --+
+ *   |   |   |   |   | (uninit)|   | x | x |   |         |
+ *   +---+---+---+---+-- ... --+   +---+---+---+-- ... --+
+ *   \_______/\_______/            \___/\___/  ^moved
+ *    from [0]  from [1]              migrated
+ *  - fibonacci index keeps order: old [i] -> new [i << shift, (i + 1) << shift)
+ *  - grow allocates new table only, no initialize and no move
+ *  - each insert / erase migrates `step` old buckets from `moved`,
+ *    and initializes their new buckets with chains sized for the data first,
+ *    bad alloc stops migration before anything moves
+ *  - data of old [i] lives in new if i < moved, else in old [i] (lookup checks one bucket)
+ *  - old table is freed when drained, next grow drains the rest at once
+ *  - iterator index: migrated new buckets, then not migrated old buckets
+ *
+ * batched lookup (find_many / exist_many)
+ *  - per BATCH keys: hash all -> prefetch all buckets -> resolve all
+ *  - bucket misses overlap instead of one after another
+ *
+ * bulk build (build)
+ *  - size     : reserve once for all data, no rehash on the way
+ *  - hash     : input split in chunks, hashed on the worker, counted per partition
+ *  - partition: counting sort by top bits of bucket index, partition owns a bucket range
+ *  - fill     : first data of bucket in place, collisions counted,
+ *               chains allocated on the caller thread (allocator may not be thread safe),
+ *               then collisions filled, no lock
+ *  - not empty or no worker: reserve once, then serial insert
+ *
+ * NOTE: step should be >= 1 / load factor, to drain before the next grow.
+ * NOTE: insert and erase invalidate iterators while migrating.
+ * NOTE: T move should not throw, pop and erase migrate in noexcept.
  **************************************************************************************************/
 
 #ifndef LWE_CONTAINER_HASH_BUFFER
@@ -37,17 +70,25 @@
 #include "../base/base.h"
 #include "../config/config.h"
 #include "../util/hash.hpp"
+#include "../mem/system.hpp"
 #include "iterator.hpp"
 
 LWE_BEGIN
+namespace async {
+class Worker; //!< bulk build, see async/worker.hpp
+} // namespace async
+
 namespace container {
 
-template<typename T> class HashedBuffer {
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, typename A = mem::System> class HashedBuffer {
 public:
-    template<typename, typename> friend class HashTable; //!< for composition
+    template<typename, typename, typename> friend class HashTable;           //!< for composition
+    template<typename, typename, typename> friend class ConcurrentHashTable; //!< for composition
 
 public:
-    CONTAINER_BODY(HashedBuffer, T, T);
+    CONTAINER_BODY(HashedBuffer, T, T, A);
+    using Allocator = A;
 
 private:
     struct Chain {
@@ -55,6 +96,8 @@ private:
         hash_t hash; // calculated hash
     };
 
+    static constexpr size_t BATCH = 16; //!< batched lookup group size
+
     struct Bucket: Chain {
         using Chain::data;
         using Chain::hash;
@@ -99,8 +142,9 @@ public:
     size_t capacity() const noexcept;      //!< get bucket count
 
 public:
-    bool reserve(size_t) noexcept; //!< reserve to power of 2
-    void clear() noexcept;         //!< clear, but no shrink
+    bool reserve(size_t) noexcept;     //!< reserve to power of 2
+    void clear() noexcept;             //!< clear, but no shrink
+    void incremental(size_t) noexcept; //!< buckets migrated per insert / erase, 0: rehash at once
 
 public:
     Iterator<FWD> find(const T&) noexcept; //!< find by data
@@ -114,17 +158,79 @@ public:
     Iterator<FWD | VIEW> begin() const noexcept;        //!< get begin const
     Iterator<FWD | VIEW> end() const noexcept;          //!< get end const
 
+public:
+    //! @brief batched find, bucket loads overlap
+    //! @param [in] in: data array
+    //! @param [in] n: data count
+    //! @param [out] out: iterator array, end() when not found
+    void find_many(const T*, size_t, Iterator<FWD>*) noexcept;
+
+    //! @brief batched exist, bucket loads overlap
+    //! @param [in] in: data array
+    //! @param [in] n: data count
+    //! @param [out] out: bool array, nullable
+    //! @return found count
+    size_t exist_many(const T*, size_t, bool* = nullptr) const noexcept;
+
+public:
+    //! @brief bulk build, sizes the table once
+    //! @param [in] in: data array, moved out when inserted
+    //! @param [in] n: data count
+    //! @param [in] worker: async::Worker, nullptr: build on this thread
+    //! @return false: bad alloc
+    //! @note T move constructor must not throw when worker is given
+    template<typename W = async::Worker> bool build(T*, size_t, W* = nullptr);
+
 private:
     template<typename U> bool emplace(U&&, hash_t);    //!< push detail
     void                      remove(Bucket*, Chain*); //!< pop detail
 
 private:
-    bool rehash(uint64_t); //!< bucket resize
-    bool expand(Bucket*);  //!< chain resize
+    bool grow();                           //!< migrate step, rehash when full
+    bool rehash(uint64_t);                 //!< bucket resize
+    bool expand(Bucket*);                  //!< chain resize
+    void migrate(size_t);                  //!< move old buckets to new table
+    void prepare(size_t, size_t) noexcept; //!< initialize new buckets [from, to)
+
+    bool divide(Bucket&, size_t, size_t) noexcept; //!< prepare new buckets [from, to) with chains for old bucket
 
 public:
     const Bucket* bucket(size_t) const noexcept; // get bucket(index)
 
+private:
+    size_t  indexof(hash_t, size_t) const noexcept; //!< hash to index of log2 size
+    size_t  edge() const noexcept;                  //!< initialized new bucket count
+    size_t  span() const noexcept;                  //!< iterable bucket count
+    Bucket* table(size_t) const noexcept;           //!< get bucket of iterator index
+
+private:
+    //! @brief find data
+    //! @param [in] hash: hash of data
+    //! @param [in] equal: bool(const T&) comparer
+    //! @param [out] owner: bucket of found, nullable
+    //! @param [out] index: iterator index of owner, nullable
+    template<typename F> Chain* locate(hash_t, F&&, Bucket** = nullptr, size_t* = nullptr) const noexcept;
+
+    //! @brief find data in bucket and chain
+    template<typename F> static Chain* scan(Bucket*, hash_t, F&&) noexcept;
+
+    //! @brief batched locate: hash group, prefetch buckets, then resolve
+    //! @param [in] in: key array
+    //! @param [in] n: key count
+    //! @param [in] hasher: hash_t(const Q&)
+    //! @param [in] equal: bool(const T&, const Q&)
+    //! @param [in] result: void(size_t nth, Chain* found, Bucket* owner, size_t index), found is nullable
+    template<typename Q, typename H, typename E, typename R> void batch(const Q*, size_t, H&&, E&&, R&&) const noexcept;
+
+    //! @brief bulk build detail
+    //! @param [in] hasher: hash_t(const T&)
+    //! @param [in] equal: bool(const T&, const T&)
+    template<typename W, typename H, typename E> bool assemble(T*, size_t, W*, H&&, E&&);
+
+    //! @brief partitioned parallel fill of empty table, see build
+    //! @return false: bad alloc, data not inserted stays in input
+    template<typename W, typename H, typename E> bool scatter(T*, size_t, W*, H&&, E&&);
+
 private:
     Bucket*       slot(hash_t) noexcept;                 //!< get bucket slot
     Chain*        slot(hash_t, const T&) noexcept;       //!< get chain slot
@@ -137,8 +243,15 @@ private:
     size_t factor    = 0;                    //!< load factor
     size_t log       = config::CAPACITY_LOG; //!< log2(capacitor): default (1 << 3) == 8
 
+private:
+    size_t step   = config::REHASHSTEP; //!< migrate count per insert / erase
+    size_t oldcap = 0;                  //!< old bucket counter
+    size_t oldlog = 0;                  //!< log2(oldcap)
+    size_t moved  = 0;                  //!< migrated old bucket count
+
 private:
     Bucket* buckets = nullptr;
+    Bucket* olds    = nullptr; //!< draining table, incremental rehash only
     Grower  grower;
 
 public:
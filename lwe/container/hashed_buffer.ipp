@@ -3,11 +3,12 @@ namespace container {
 /**************************************************************************************************
  * Iterator
  **************************************************************************************************/
-REGISTER_CONST_ITERATOR((typename T), FWD, HashedBuffer, T);
+REGISTER_CONST_ITERATOR((typename T, typename A), FWD, HashedBuffer, T, A);
 
-template<typename T> class Iterator<FWD, HashedBuffer<T>> {
-    ITERATOR_BODY(FWD, HashedBuffer, T);
+template<typename T, typename A> class Iterator<FWD, HashedBuffer<T, A>> {
+    ITERATOR_BODY(FWD, HashedBuffer, T, A);
     using Bucket = typename HashedBuffer::Bucket;
+    friend HashedBuffer; //!< erase
 
 public:
     Iterator(HashedBuffer* self, size_t index): self(self), index(index), chain(0), chaining(false) { }
@@ -19,7 +20,7 @@ public:
 
 public:
     Iterator& operator++() {
-        size_t max = self->capacitor;
+        size_t max = self->span();
         if(index == max) {
             return *this; // end
         }
@@ -28,13 +29,13 @@ public:
             chaining = true;
         }
         else ++chain;
-        if(chain >= self->buckets[index].capacity) {
+        if(chain >= self->table(index)->size) {
             chaining = false;
             chain    = 0;
             // next
             while(true) {
                 ++index;
-                if(index == max || self->buckets[index].used == true) {
+                if(index == max || self->table(index)->used == true) {
                     break; // end or found
                 }
             }
@@ -57,10 +58,11 @@ public:
         else {
             while(index > 0) {
                 --index;
-                if(self->buckets[index].used == true) {
-                    if(self->buckets[index].size != 0) {
-                        chaining = true;                          // chain
-                        chain    = self->buckets[index].size - 1; // chain end
+                Bucket* bucket = self->table(index);
+                if(bucket->used == true) {
+                    if(bucket->size != 0) {
+                        chaining = true;             // chain
+                        chain    = bucket->size - 1; // chain end
                     }
                     break;
                 }
@@ -71,7 +73,7 @@ public:
 
 public:
     T& operator*() {
-        Bucket& bucket = self->buckets[index];
+        Bucket& bucket = *self->table(index);
         if(chaining) {
             return bucket.chain[chain].data; // return chain data
         }
@@ -102,29 +104,29 @@ private:
  * HashedBuffer
  **************************************************************************************************/
 
-template<typename T> HashedBuffer<T>::HashedBuffer(float factor, Grower grower): LOAD_FACTOR(factor), grower(grower) { }
+template<typename T, typename A> HashedBuffer<T, A>::HashedBuffer(float factor, Grower grower): LOAD_FACTOR(factor), grower(grower) { }
 
-template<typename T> HashedBuffer<T>::HashedBuffer(Grower grower): HashedBuffer(config::LOADFACTOR, grower) { }
+template<typename T, typename A> HashedBuffer<T, A>::HashedBuffer(Grower grower): HashedBuffer(config::LOADFACTOR, grower) { }
 
-template<typename T> HashedBuffer<T>::~HashedBuffer() {
+template<typename T, typename A> HashedBuffer<T, A>::~HashedBuffer() {
     if(buckets) {
         clear();
-        std::free(buckets);
+        A::deallocate(buckets);
     }
 }
 
-template<typename T> bool HashedBuffer<T>::push(T&& in) {
+template<typename T, typename A> bool HashedBuffer<T, A>::push(T&& in) {
     return insert(std::move(in));
 }
 
-template<typename T> bool HashedBuffer<T>::push(const T& in) {
+template<typename T, typename A> bool HashedBuffer<T, A>::push(const T& in) {
     return insert(in);
 }
 
-template<typename T> bool HashedBuffer<T>::pop(const T& in) noexcept {
-    hash_t  hashed = util::Hash<T>(in);         // get hash
-    Bucket* bucket = buckets + indexof(hashed); // get bucket
-    Chain*  pos    = slot(hashed, in);          // get delete pos
+template<typename T, typename A> bool HashedBuffer<T, A>::pop(const T& in) noexcept {
+    hash_t  hashed = util::Hash<T>(in); // get hash
+    Bucket* bucket = nullptr;           // owner
+    Chain*  pos    = locate(hashed, [&in](const T& data) { return data == in; }, &bucket);
     if(pos == nullptr) {
         return false; // not found
     }
@@ -132,55 +134,67 @@ template<typename T> bool HashedBuffer<T>::pop(const T& in) noexcept {
     return true;
 }
 
-template<typename T> bool HashedBuffer<T>::exist(const T& in) noexcept {
-    return slot(in, util::Hash<T>(in)) != nullptr;
+template<typename T, typename A> bool HashedBuffer<T, A>::exist(const T& in) noexcept {
+    hash_t hashed = util::Hash<T>(in);
+    return locate(hashed, [&in](const T& data) { return data == in; }) != nullptr;
 }
 
-template<typename T>
-template<typename U> bool HashedBuffer<T>::insert(U&& in) {
+template<typename T, typename A>
+template<typename U> bool HashedBuffer<T, A>::insert(U&& in) {
     hash_t hashed = util::Hash<T>(in);
     // check
     if(slot(hashed, in) != nullptr) {
         return false;
     }
-    if(counter >= factor) {
-        // capacitor << 1
-        if(!rehash(log + 1)) {
-            return false;
-        }
+    if(!grow()) {
+        return false;
     }
     return emplace(std::forward<U>(in), hashed);
 }
 
-template<typename T> bool HashedBuffer<T>::erase(const Iterator<FWD>& in) noexcept {
-    Bucket* bucket = buckets[in.index]; // get bucket
-    if(in.self != this || in.chain >= bucket->capacity) {
+template<typename T, typename A> bool HashedBuffer<T, A>::erase(const Iterator<FWD>& in) noexcept {
+    if(in.self != this || in.index >= span()) {
         return false; // exception
     }
-    Chain* chain = in.chaining ? (bucket + in.chain) : bucket; // get data
+    Bucket* bucket = table(in.index); // get bucket
+    if(in.chaining ? in.chain >= bucket->size : !bucket->used) {
+        return false; // exception
+    }
+    Chain* chain = in.chaining ? (bucket->chain + in.chain) : bucket; // get data
     remove(bucket, chain);
     return true;
 }
 
-template<typename T> size_t HashedBuffer<T>::indexof(hash_t in) const noexcept {
+template<typename T, typename A> size_t HashedBuffer<T, A>::indexof(hash_t in) const noexcept {
+    // not migrated yet, old bucket
+    if(olds) {
+        size_t old = indexof(in, oldlog);
+        if(old >= moved) {
+            return edge() + (old - moved);
+        }
+    }
+    return indexof(in, log);
+}
+
+template<typename T, typename A> size_t HashedBuffer<T, A>::indexof(hash_t in, size_t bits) const noexcept {
     static constexpr size_t FIBONACCI_PRIME = []() {
         if constexpr(sizeof(size_t) == 8) {
             return 11'400'714'819'323'198'485ull;
         }
         else return 2'654'435'769u;
     }();
-    return (in * FIBONACCI_PRIME) >> ((sizeof(size_t) << 3) - log);
+    return (in * FIBONACCI_PRIME) >> ((sizeof(size_t) << 3) - bits);
 }
 
-template<typename T> size_t HashedBuffer<T>::size() const noexcept {
+template<typename T, typename A> size_t HashedBuffer<T, A>::size() const noexcept {
     return counter;
 }
 
-template<typename T> size_t HashedBuffer<T>::capacity() const noexcept {
+template<typename T, typename A> size_t HashedBuffer<T, A>::capacity() const noexcept {
     return capacitor;
 }
 
-template<typename T> bool HashedBuffer<T>::reserve(size_t in) noexcept {
+template<typename T, typename A> bool HashedBuffer<T, A>::reserve(size_t in) noexcept {
     // algin to power of 2
     in = core::align(in);
     if(in <= capacitor) {
@@ -201,59 +215,69 @@ template<typename T> bool HashedBuffer<T>::reserve(size_t in) noexcept {
     return true;
 }
 
-template<typename T> void HashedBuffer<T>::clear() noexcept {
-    if(capacitor != 0) {
+template<typename T, typename A> void HashedBuffer<T, A>::clear() noexcept {
+    if(capacitor == 0) {
         return;
     }
 
-    for(size_t i = 0; i < capacitor; ++i) {
+    for(size_t i = 0; i < span(); ++i) {
+        Bucket* bucket = table(i);
         // delete bucket data
-        if(buckets[i].used == true) {
-            buckets[i].data.~T(); // bucket dtor
+        if(bucket->used == true) {
+            bucket->data.~T(); // bucket dtor
+            bucket->used = false;
         }
         // has chain
-        if(buckets[i].chain) {
-            for(uint16_t j = 0; j < buckets[i].size; ++j) {
+        if(bucket->chain) {
+            for(uint16_t j = 0; j < bucket->size; ++j) {
                 // MSVC C6001 FALSE POSITIVE
-                buckets[i].chain[j].data.~T(); // chain dtor
+                bucket->chain[j].data.~T(); // chain dtor
             }
-            std::free(buckets[i].chain); // delete
+            A::deallocate(bucket->chain); // delete
+            bucket->chain    = nullptr;
+            bucket->size     = 0;
+            bucket->capacity = 0;
         }
     }
 
+    // drop old table
+    if(olds) {
+        prepare(edge(), capacitor);
+        A::deallocate(olds);
+        olds   = nullptr;
+        oldcap = 0;
+        moved  = 0;
+    }
+
     // init
     // ignore bucket, capacity
     counter = 0;
-    factor  = 0;
 }
 
-template<typename T> auto HashedBuffer<T>::find(const T& in) noexcept -> Iterator<FWD> {
+template<typename T, typename A> void HashedBuffer<T, A>::incremental(size_t in) noexcept {
+    step = in;
+}
+
+template<typename T, typename A> auto HashedBuffer<T, A>::find(const T& in) noexcept -> Iterator<FWD> {
     if(buckets == nullptr) {
         return end();
     }
 
     hash_t  hashed = util::Hash<T>(in); // get hash
-    size_t  index  = indexof(hashed);
-    Bucket& bucket = buckets[index];
-
-    // check has data
-    if(bucket.used == true) {
-        // not chain, or first data
-        if(bucket.hash == hashed && bucket.data == in) {
-            return Iterator<FWD>(this, index);
-        }
-        // return chain
-        for(uint16_t i = 0; i < bucket.size; ++i) {
-            Chain* chain = bucket.chain + i;
-            if(chain->hash == hashed && chain->data == in) {
-                return Iterator<FWD>(this, index, i);
-            }
-        }
+    Bucket* bucket = nullptr;
+    size_t  index  = 0;
+    Chain*  chain  = locate(hashed, [&in](const T& data) { return data == in; }, &bucket, &index);
+
+    if(chain == nullptr) {
+        return end(); // not found
     }
-    return end(); // not found
+    if(chain == bucket) {
+        return Iterator<FWD>(this, index); // not chain, or first data
+    }
+    return Iterator<FWD>(this, index, uint16_t(chain - bucket->chain)); // chain
 }
 
-template<typename T> auto HashedBuffer<T>::at(size_t index) noexcept -> Iterator<FWD> {
+template<typename T, typename A> auto HashedBuffer<T, A>::at(size_t index) noexcept -> Iterator<FWD> {
     size_t pass = 0;
     // out of range
     if(index >= counter) {
@@ -261,9 +285,10 @@ template<typename T> auto HashedBuffer<T>::at(size_t index) noexcept -> Iterator
     }
 
     // loop
-    for(size_t i = 0; i < capacitor; ++i) {
+    for(size_t i = 0; i < span(); ++i) {
+        Bucket* bucket = table(i);
         // empty bucket pass
-        if(buckets[i].used == false) {
+        if(bucket->used == false) {
             continue;
         }
         // check bucket pos
@@ -273,7 +298,7 @@ template<typename T> auto HashedBuffer<T>::at(size_t index) noexcept -> Iterator
         pass += 1; // bucket pass
 
         // check chain
-        if(buckets[i].size == 0) {
+        if(bucket->size == 0) {
             continue; // not exist
         }
 
@@ -285,7 +310,7 @@ template<typename T> auto HashedBuffer<T>::at(size_t index) noexcept -> Iterator
         // 2 + 3 == 5
         // index - pass -> 2 - 2 == 0
         // [1][0] == 2
-        size_t size = buckets[i].size;
+        size_t size = bucket->size;
         if(index < (pass + size)) {
             return Iterator<FWD>(this, i, uint16_t(index - pass));
         }
@@ -296,39 +321,73 @@ template<typename T> auto HashedBuffer<T>::at(size_t index) noexcept -> Iterator
     return end();
 }
 
-template<typename T> auto HashedBuffer<T>::begin() noexcept -> Iterator<FWD> {
+template<typename T, typename A> auto HashedBuffer<T, A>::begin() noexcept -> Iterator<FWD> {
     size_t index = 0;
-    for(; index < capacitor; ++index) {
-        if(buckets[index].used == true) {
+    for(; index < span(); ++index) {
+        if(table(index)->used == true) {
             break;
         }
     }
     return Iterator<FWD>(this, index);
 }
 
-template<typename T> auto HashedBuffer<T>::end() noexcept -> Iterator<FWD> {
-    return Iterator<FWD>(this, capacitor);
+template<typename T, typename A> auto HashedBuffer<T, A>::end() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, span());
 }
 
-template<typename T> auto HashedBuffer<T>::find(const T& in) const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, typename A> auto HashedBuffer<T, A>::find(const T& in) const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashedBuffer*>(this)->find(in);
 }
 
-template<typename T> auto HashedBuffer<T>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, typename A> auto HashedBuffer<T, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashedBuffer*>(this)->at(in);
 }
 
-template<typename T> auto HashedBuffer<T>::begin() const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, typename A> auto HashedBuffer<T, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashedBuffer*>(this)->begin();
 }
 
-template<typename T> auto HashedBuffer<T>::end() const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, typename A> auto HashedBuffer<T, A>::end() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<HashedBuffer*>(this)->end();
 }
 
-template<typename T>
-template<typename U> bool HashedBuffer<T>::emplace(U&& in, hash_t hashed) {
-    Bucket* bucket = buckets + (indexof(hashed));
+template<typename T, typename A> void HashedBuffer<T, A>::find_many(const T* in, size_t n, Iterator<FWD>* out) noexcept {
+    batch(
+        in, n, [](const T& key) -> hash_t { return util::Hash<T>(key); },
+        [](const T& data, const T& key) { return data == key; },
+        [this, out](size_t nth, Chain* found, Bucket* bucket, size_t index) {
+            if(found == nullptr) {
+                out[nth] = end(); // not found
+            }
+            else if(found == bucket) {
+                out[nth] = Iterator<FWD>(this, index); // not chain, or first data
+            }
+            else out[nth] = Iterator<FWD>(this, index, uint16_t(found - bucket->chain)); // chain
+        });
+}
+
+template<typename T, typename A> size_t HashedBuffer<T, A>::exist_many(const T* in, size_t n, bool* out) const noexcept {
+    size_t total = 0;
+    batch(
+        in, n, [](const T& key) -> hash_t { return util::Hash<T>(key); },
+        [](const T& data, const T& key) { return data == key; },
+        [&total, out](size_t nth, Chain* found, Bucket*, size_t) {
+            if(out) out[nth] = found != nullptr;
+            total += found != nullptr;
+        });
+    return total;
+}
+
+template<typename T, typename A>
+template<typename W> bool HashedBuffer<T, A>::build(T* in, size_t n, W* worker) {
+    return assemble(
+        in, n, worker, [](const T& data) -> hash_t { return util::Hash<T>(data); },
+        [](const T& data, const T& key) { return data == key; });
+}
+
+template<typename T, typename A>
+template<typename U> bool HashedBuffer<T, A>::emplace(U&& in, hash_t hashed) {
+    Bucket* bucket = table(indexof(hashed));
     Chain*  pos    = nullptr;
     if(!bucket) throw diag::error(diag::INVALID_DATA);
 
@@ -353,7 +412,7 @@ template<typename U> bool HashedBuffer<T>::emplace(U&& in, hash_t hashed) {
     return true;
 }
 
-template<typename T> void HashedBuffer<T>::remove(Bucket* bucket, Chain* del) {
+template<typename T, typename A> void HashedBuffer<T, A>::remove(Bucket* bucket, Chain* del) {
     // delete first data
     if(bucket == del) {
         // has chain, swap and delete
@@ -384,31 +443,65 @@ template<typename T> void HashedBuffer<T>::remove(Bucket* bucket, Chain* del) {
         else del->data.~T(); // delete
     }
     --counter; // total count
+
+    // incremental rehash step
+    if(olds) {
+        migrate(step);
+    }
 }
 
-template<typename T> bool HashedBuffer<T>::rehash(uint64_t caplog) {
+template<typename T, typename A> bool HashedBuffer<T, A>::grow() {
+    // incremental rehash step
+    if(olds) {
+        migrate(step);
+    }
+    // capacitor << 1
+    if(counter >= factor) {
+        return rehash(log + 1);
+    }
+    return true;
+}
+
+template<typename T, typename A> bool HashedBuffer<T, A>::rehash(uint64_t caplog) {
     size_t size = (size_t(1) << caplog);
     if(size <= capacitor) {
         return false; // shrink not allow
     }
 
+    // drain rest of previous incremental rehash
+    if(olds) {
+        migrate(oldcap);
+        if(olds) {
+            return false; // bad alloc, not drained
+        }
+    }
+
     // realloc
     Bucket* old = buckets; // backup
-    buckets     = static_cast<Bucket*>(std::malloc(sizeof(Bucket) * size));
+    buckets     = static_cast<Bucket*>(A::allocate(sizeof(Bucket) * size));
     if(!buckets) {
         buckets = old; // rollback
         return false;  // bad alloc
     }
 
-    // initialize
-    for(size_t i = 0; i < size; ++i) {
-        buckets[i].used     = false;
-        buckets[i].chain    = nullptr;
-        buckets[i].size     = 0;
-        buckets[i].capacity = 0;
-    }
     size_t loop = capacitor; // old size for loop
 
+    // incremental: keep old table, initialize new buckets on migrate
+    if(step != 0 && old && counter != 0) {
+        olds   = old;
+        oldcap = loop;
+        oldlog = log;
+        moved  = 0;
+
+        log       = caplog;
+        capacitor = size;
+        factor    = size_t(size * LOAD_FACTOR);
+        return true;
+    }
+
+    // initialize
+    prepare(0, size);
+
     log       = caplog;                     // update for fibonachi hash
     capacitor = size;                       // update
     factor    = size_t(size * LOAD_FACTOR); // update
@@ -431,17 +524,20 @@ template<typename T> bool HashedBuffer<T>::rehash(uint64_t caplog) {
                     chain.data.~T();                            // delete
                 }
                 // MSVC C6001 FALSE POSITIVE
-                std::free(old[i].chain); // delete
+                A::deallocate(old[i].chain); // delete
             }
         }
-        std::free(old); // delete
+        A::deallocate(old); // delete
     }
     return true;
 }
 
-template<typename T> bool HashedBuffer<T>::expand(Bucket* in) {
-    uint16_t cap   = grower(in->capacity);
-    Chain*   newly = static_cast<Chain*>(std::malloc(sizeof(Chain) * cap));
+template<typename T, typename A> bool HashedBuffer<T, A>::expand(Bucket* in) {
+    uint16_t cap = grower(in->capacity);
+    if(cap <= in->capacity) {
+        return false; // saturated
+    }
+    Chain* newly = static_cast<Chain*>(A::allocate(sizeof(Chain) * cap));
     if(!newly) {
         return false; // bad alloc
     }
@@ -455,47 +551,406 @@ template<typename T> bool HashedBuffer<T>::expand(Bucket* in) {
     }
     in->chain    = newly; // store
     in->capacity = cap;   // count
-    std::free(old);       // delete
+    A::deallocate(old);   // delete
     return true;
 }
 
-template<typename T> auto HashedBuffer<T>::bucket(size_t in) const noexcept -> const Bucket* {
-    if(in >= capacitor) {
+template<typename T, typename A> void HashedBuffer<T, A>::migrate(size_t count) {
+    size_t total = counter;      // emplace counts again
+    size_t shift = log - oldlog; // old bucket -> 1 << shift new buckets
+
+    for(; count != 0 && moved < oldcap; --count) {
+        Bucket& bucket = olds[moved];
+        if(!divide(bucket, moved << shift, (moved + 1) << shift)) {
+            break; // bad alloc, bucket stays old and found there
+        }
+        ++moved; // route to new buckets
+
+        // main data, chains are reserved and emplace does not fail
+        if(bucket.used == true) {
+            emplace(std::move(bucket.data), bucket.hash); // move
+            bucket.data.~T();                             // delete
+            bucket.used = false;                          // lookup skips
+        }
+        // chained datas
+        if(bucket.chain) {
+            for(uint16_t i = 0; i < bucket.size; ++i) {
+                Chain& chain = bucket.chain[i];
+                emplace(std::move(chain.data), chain.hash); // move
+                chain.data.~T();                            // delete
+            }
+            A::deallocate(bucket.chain); // delete
+        }
+    }
+    counter = total;
+
+    // drained
+    if(moved == oldcap) {
+        A::deallocate(olds);
+        olds   = nullptr;
+        oldcap = 0;
+        moved  = 0;
+    }
+}
+
+template<typename T, typename A> bool HashedBuffer<T, A>::divide(Bucket& in, size_t from, size_t to) noexcept {
+    prepare(from, to);
+
+    // count data per new bucket, used: first data, size: chained
+    auto count = [this](hash_t hashed) {
+        Bucket& bucket = buckets[indexof(hashed, log)];
+        if(bucket.used == true) ++bucket.size;
+        else bucket.used = true;
+    };
+    if(in.used == true) {
+        count(in.hash);
+    }
+    for(uint16_t i = 0; i < in.size; ++i) {
+        count(in.chain[i].hash);
+    }
+
+    // chains by count, then empty again for emplace
+    bool result = true;
+    for(size_t i = from; i < to; ++i) {
+        Bucket& bucket = buckets[i];
+        if(result && bucket.size != 0) {
+            bucket.chain    = static_cast<Chain*>(A::allocate(sizeof(Chain) * bucket.size));
+            bucket.capacity = bucket.chain ? bucket.size : 0;
+            result          = bucket.chain != nullptr;
+        }
+        bucket.used = false;
+        bucket.size = 0;
+    }
+
+    // rollback
+    if(!result) {
+        for(size_t i = from; i < to; ++i) {
+            if(buckets[i].chain) {
+                A::deallocate(buckets[i].chain);
+            }
+        }
+        prepare(from, to);
+    }
+    return result;
+}
+
+template<typename T, typename A> auto HashedBuffer<T, A>::bucket(size_t in) const noexcept -> const Bucket* {
+    if(in >= span()) {
         return nullptr; // exception
     }
-    return buckets + in;
+    return table(in);
 }
 
-template<typename T> auto HashedBuffer<T>::slot(hash_t in) noexcept -> Bucket* {
-    if(capacitor == 0) {
-        rehash(log); // init
+template<typename T, typename A> void HashedBuffer<T, A>::prepare(size_t from, size_t to) noexcept {
+    for(size_t i = from; i < to; ++i) {
+        buckets[i].used     = false;
+        buckets[i].chain    = nullptr;
+        buckets[i].size     = 0;
+        buckets[i].capacity = 0;
     }
-    return buckets + indexof(in);
 }
 
-template<typename T> auto HashedBuffer<T>::slot(hash_t in, const T& data) noexcept -> Chain* {
-    if(capacitor == 0) {
-        rehash(log); // init
+template<typename T, typename A> size_t HashedBuffer<T, A>::edge() const noexcept {
+    return moved << (log - oldlog);
+}
+
+template<typename T, typename A> size_t HashedBuffer<T, A>::span() const noexcept {
+    if(olds) {
+        return edge() + (oldcap - moved);
     }
-    Bucket* bucket = buckets + (indexof(in));
+    return capacitor;
+}
 
-    if(bucket->hash == in && bucket->data == data) {
+template<typename T, typename A> auto HashedBuffer<T, A>::table(size_t in) const noexcept -> Bucket* {
+    if(olds) {
+        size_t prepared = edge();
+        if(in >= prepared) {
+            return olds + moved + (in - prepared); // not migrated
+        }
+    }
+    return buckets + in;
+}
+
+template<typename T, typename A>
+template<typename F> auto HashedBuffer<T, A>::locate(hash_t in, F&& equal, Bucket** owner, size_t* index) const noexcept
+    -> Chain* {
+    if(buckets == nullptr) {
+        return nullptr;
+    }
+
+    size_t  pos    = indexof(in);
+    Bucket* bucket = table(pos);
+    Chain*  found  = scan(bucket, in, equal);
+
+    if(found) {
+        if(owner) *owner = bucket;
+        if(index) *index = pos;
+    }
+    return found;
+}
+
+template<typename T, typename A>
+template<typename F> auto HashedBuffer<T, A>::scan(Bucket* bucket, hash_t in, F&& equal) noexcept -> Chain* {
+    // empty bucket has no chain
+    if(bucket->used == false) {
+        return nullptr;
+    }
+    if(bucket->hash == in && equal(bucket->data)) {
         return bucket;
     }
     for(uint16_t i = 0; i < bucket->size; ++i) {
         Chain* chain = bucket->chain + i;
-        if(chain->hash == in && chain->data == data) {
+        if(chain->hash == in && equal(chain->data)) {
             return chain;
         }
     }
     return nullptr;
 }
 
-template<typename T> auto HashedBuffer<T>::slot(hash_t in) const noexcept -> const Bucket* {
+template<typename T, typename A>
+template<typename Q, typename H, typename E, typename R>
+void HashedBuffer<T, A>::batch(const Q* in, size_t n, H&& hasher, E&& equal, R&& result) const noexcept {
+    hash_t hashes[BATCH];
+    size_t indices[BATCH];
+
+    for(size_t from = 0; from < n; from += BATCH) {
+        size_t count = (n - from) < BATCH ? (n - from) : BATCH;
+
+        // empty table
+        if(buckets == nullptr) {
+            for(size_t i = 0; i < count; ++i) result(from + i, nullptr, nullptr, 0);
+            continue;
+        }
+
+        // hash all and prefetch buckets, one line per lookup
+        for(size_t i = 0; i < count; ++i) {
+            hashes[i]      = hasher(in[from + i]);
+            indices[i]     = indexof(hashes[i]);
+            Bucket* bucket = table(indices[i]);
+            core::prefetch(bucket);
+        }
+
+        // resolve, loads are in flight
+        for(size_t i = 0; i < count; ++i) {
+            const Q& key    = in[from + i];
+            Bucket*  bucket = table(indices[i]);
+            Chain*   found  = scan(bucket, hashes[i], [&](const T& data) { return equal(data, key); });
+            result(from + i, found, bucket, indices[i]);
+        }
+    }
+}
+
+template<typename T, typename A>
+template<typename W, typename H, typename E> bool HashedBuffer<T, A>::assemble(T* in, size_t n, W* worker, H&& hasher, E&& equal) {
+    if(n == 0) {
+        return true;
+    }
+
+    // empty: drop chains and old table left by pop, partitions start clean
+    bool parallel = worker != nullptr && counter == 0;
+    if(parallel) {
+        clear();
+    }
+
+    // size once, count <= load factor * capacity
+    size_t need = size_t(double(counter + n) / double(LOAD_FACTOR));
+    if(size_t(float(need) * LOAD_FACTOR) < counter + n) {
+        ++need; // round up
+    }
+    if(!reserve(need < (size_t(1) << config::CAPACITY_LOG) ? (size_t(1) << config::CAPACITY_LOG) : need)) {
+        return false; // bad alloc
+    }
+
+    if(parallel) {
+        return scatter(in, n, worker, hasher, equal);
+    }
+
+    // serial
+    for(size_t i = 0; i < n; ++i) {
+        hash_t hashed = hasher(in[i]);
+        if(locate(hashed, [&](const T& data) { return equal(data, in[i]); }) != nullptr) {
+            continue; // exist
+        }
+        if(!grow() || !emplace(std::move(in[i]), hashed)) {
+            return false; // bad alloc
+        }
+    }
+    return true;
+}
+
+template<typename T, typename A>
+template<typename W, typename H, typename E> bool HashedBuffer<T, A>::scatter(T* in, size_t n, W* worker, H&& hasher, E&& equal) {
+    static constexpr size_t DONE = size_t(-1); // placed or duplicated
+
+    // partition: power of 2, a few per thread for balance
+    size_t parts = core::align((worker->size() + 1) << 2);
+    if(parts > capacitor) {
+        parts = capacitor;
+    }
+    size_t plog = 0;
+    for(size_t i = parts; i > 1; i >>= 1) {
+        ++plog;
+    }
+    size_t width = (n + parts - 1) / parts; // input chunk size
+
+    // scratch
+    // counts: [chunk][partition] count, then write cursor
+    // bounds: partition range of order
+    // placed: inserted count of partition
+    hash_t* hashes = static_cast<hash_t*>(mem::System::allocate(sizeof(hash_t) * n));
+    size_t* order  = static_cast<size_t*>(mem::System::allocate(sizeof(size_t) * n));
+    size_t* counts = static_cast<size_t*>(mem::System::allocate(sizeof(size_t) * (parts * parts + (parts + 1) + parts)));
+    if(!hashes || !order || !counts) {
+        mem::System::deallocate(hashes);
+        mem::System::deallocate(order);
+        mem::System::deallocate(counts);
+        return false; // bad alloc
+    }
+    size_t* bounds = counts + parts * parts;
+    size_t* placed = bounds + parts + 1;
+
+    // hash and count per partition
+    worker->dispatch(parts, [&](size_t chunk) {
+        size_t* count = counts + chunk * parts;
+        size_t  from  = chunk * width < n ? chunk * width : n;
+        size_t  to    = from + width < n ? from + width : n;
+        for(size_t p = 0; p < parts; ++p) {
+            count[p] = 0;
+        }
+        for(size_t i = from; i < to; ++i) {
+            hashes[i] = hasher(in[i]);
+            ++count[indexof(hashes[i], plog)];
+        }
+    });
+
+    // prefix sum, partition major
+    size_t sum = 0;
+    for(size_t p = 0; p < parts; ++p) {
+        bounds[p] = sum;
+        for(size_t chunk = 0; chunk < parts; ++chunk) {
+            size_t count              = counts[chunk * parts + p];
+            counts[chunk * parts + p] = sum; // cursor
+            sum                      += count;
+        }
+    }
+    bounds[parts] = n;
+
+    // counting sort, chunk writes own cursors
+    worker->dispatch(parts, [&](size_t chunk) {
+        size_t* cursor = counts + chunk * parts;
+        size_t  from   = chunk * width < n ? chunk * width : n;
+        size_t  to     = from + width < n ? from + width : n;
+        for(size_t i = from; i < to; ++i) {
+            order[cursor[indexof(hashes[i], plog)]++] = i;
+        }
+    });
+
+    // first data in place, count collisions on capacity
+    worker->dispatch(parts, [&](size_t p) {
+        size_t count = 0;
+        for(size_t k = bounds[p]; k < bounds[p + 1]; ++k) {
+            size_t  i      = order[k];
+            Bucket* bucket = buckets + indexof(hashes[i], log);
+            if(bucket->used == false) {
+                new(&bucket->data) T(std::move(in[i])); // move
+                bucket->hash = hashes[i];
+                bucket->used = true;
+                order[k]     = DONE;
+                ++count;
+            }
+            else if(bucket->hash == hashes[i] && equal(bucket->data, in[i])) {
+                order[k] = DONE; // exist
+            }
+            else if(bucket->capacity != UINT16_MAX) {
+                ++bucket->capacity; // chain later
+            }
+        }
+        placed[p] = count;
+    });
+
+    // chains, allocator on this thread only
+    bool result = true;
+    for(size_t i = 0; i < capacitor; ++i) {
+        Bucket& bucket = buckets[i];
+        if(bucket.capacity == 0) {
+            continue;
+        }
+        bucket.chain = static_cast<Chain*>(A::allocate(sizeof(Chain) * bucket.capacity));
+        if(!bucket.chain) {
+            bucket.capacity = 0;     // no space, skipped
+            result          = false; // bad alloc
+        }
+    }
+
+    // collisions
+    worker->dispatch(parts, [&](size_t p) {
+        size_t count = 0;
+        for(size_t k = bounds[p]; k < bounds[p + 1]; ++k) {
+            size_t i = order[k];
+            if(i == DONE) {
+                continue;
+            }
+            Bucket* bucket = buckets + indexof(hashes[i], log);
+            if(scan(bucket, hashes[i], [&](const T& data) { return equal(data, in[i]); }) != nullptr) {
+                order[k] = DONE; // exist
+                continue;
+            }
+            if(bucket->size >= bucket->capacity) {
+                continue; // bad alloc or saturated, serial later
+            }
+            Chain* pos = bucket->chain + bucket->size;
+            new(&pos->data) T(std::move(in[i])); // move
+            pos->hash     = hashes[i];
+            bucket->size += 1;
+            order[k]      = DONE;
+            ++count;
+        }
+        placed[p] += count;
+    });
+
+    for(size_t p = 0; p < parts; ++p) {
+        counter += placed[p];
+    }
+
+    // leftovers, same as serial path
+    for(size_t k = 0; k < n && result; ++k) {
+        size_t i = order[k];
+        if(i == DONE) {
+            continue;
+        }
+        if(locate(hashes[i], [&](const T& data) { return equal(data, in[i]); }) != nullptr) {
+            continue; // exist
+        }
+        if(!grow() || !emplace(std::move(in[i]), hashes[i])) {
+            result = false; // bad alloc or saturated
+        }
+    }
+
+    mem::System::deallocate(hashes);
+    mem::System::deallocate(order);
+    mem::System::deallocate(counts);
+    return result;
+}
+
+template<typename T, typename A> auto HashedBuffer<T, A>::slot(hash_t in) noexcept -> Bucket* {
+    if(capacitor == 0) {
+        rehash(log); // init
+    }
+    return table(indexof(in));
+}
+
+template<typename T, typename A> auto HashedBuffer<T, A>::slot(hash_t in, const T& data) noexcept -> Chain* {
+    if(capacitor == 0) {
+        rehash(log); // init
+    }
+    return locate(in, [&data](const T& it) { return it == data; });
+}
+
+template<typename T, typename A> auto HashedBuffer<T, A>::slot(hash_t in) const noexcept -> const Bucket* {
     return const_cast<HashedBuffer*>(this)->slot(in);
 }
 
-template<typename T> auto HashedBuffer<T>::slot(hash_t in, const T& data) const noexcept -> const Chain* {
+template<typename T, typename A> auto HashedBuffer<T, A>::slot(hash_t in, const T& data) const noexcept -> const Chain* {
     return const_cast<HashedBuffer*>(this)->slot(in, data);
 }
 
@@ -7,6 +7,10 @@
     - insert(index, T)
     - remove(index, T*)
 
+    ! RELOCATABLE (core::Relocatable<T>) !
+    grow, swap, move: memcpy / memmove instead of move constructor and destructor
+    grow in place by A::reallocate when the allocator policy has it (e.g. System, Heap)
+
     ! SWAP AND DELETE / INSERT !
     e.g.
     +-----------------+
@@ -29,19 +33,22 @@
 
 #include "../config/config.h"
 #include "../mem/block.hpp"
+#include "../mem/system.hpp"
 #include "iterator.hpp"
 
 LWE_BEGIN
 namespace container {
 
 //! @tparam N count of T, 0 is auto size (64 byte)
-template<typename T, size_t SVO = 0>
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, size_t SVO = 0, typename A = mem::System>
 class LinearBuffer {
-    template<typename, size_t> friend class LinearBuffer; //!< for LinearBuffer<T, OTHER_SVO_SIZE>
-    template<typename, size_t> friend class RingBuffer;   //!< for composition
+    template<typename, size_t, typename> friend class LinearBuffer; //!< for LinearBuffer<T, OTHER_SVO_SIZE>
+    template<typename, size_t, typename> friend class RingBuffer;   //!< for composition
 
 public:
-    CONTAINER_BODY(LinearBuffer, T, T, SVO);
+    CONTAINER_BODY(LinearBuffer, T, T, SVO, A);
+    using Allocator = A;
 
 private:
     static constexpr size_t min() {
@@ -61,10 +68,10 @@ public:
     ~LinearBuffer();
 
 public:
-    template<size_t N> LinearBuffer(const LinearBuffer<T, N>&);
-    template<size_t N> LinearBuffer(LinearBuffer<T, N>&&) noexcept;
-    template<size_t N> LinearBuffer<T, N>& operator=(const LinearBuffer<T, N>&);
-    template<size_t N> LinearBuffer<T, N>& operator=(LinearBuffer<T, N>&&) noexcept;
+    template<size_t N> LinearBuffer(const LinearBuffer<T, N, A>&);
+    template<size_t N> LinearBuffer(LinearBuffer<T, N, A>&&) noexcept;
+    template<size_t N> LinearBuffer<T, N, A>& operator=(const LinearBuffer<T, N, A>&);
+    template<size_t N> LinearBuffer<T, N, A>& operator=(LinearBuffer<T, N, A>&&) noexcept;
 
 public:
     T& operator[](index_t) noexcept;             //!<
@@ -137,10 +144,11 @@ private:
 
 private:
     template<size_t X, bool COPY> using Other =
-        std::conditional_t<COPY, const LinearBuffer<T, X>&, LinearBuffer<T, X>&&>;
+        std::conditional_t<COPY, const LinearBuffer<T, X, A>&, LinearBuffer<T, X, A>&&>;
     template<size_t X, bool COPY> bool ctor(Other<X, COPY>, index_t = 0);           //!< copy / move delegator
-    template<bool> void                transfer(const T*, T*, index_t, size_t = 0); //!< true: copy, false: move
-    bool                               reallocate(size_t, index_t = 0);             //!< call realloc (size, begin)
+    template<bool> void                transfer(const T*, T*, index_t, size_t, size_t); //!< true: copy, false: move
+    bool                               reallocate(size_t, index_t = 0);                 //!< call realloc (size, begin)
+    static void                        relocate(T*, T*, size_t = 1) noexcept;           //!< move and destroy source
 
 protected:
     void clear(size_t);
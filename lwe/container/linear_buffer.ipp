@@ -5,8 +5,8 @@ namespace container {
  * Iterator Specialization
  **************************************************************************************************/
 
-template<typename T, size_t SVO> class Iterator<FWD, LinearBuffer<T, SVO>> {
-    ITERATOR_BODY(FWD, LinearBuffer, T, SVO);
+template<typename T, size_t SVO, typename A> class Iterator<FWD, LinearBuffer<T, SVO, A>> {
+    ITERATOR_BODY(FWD, LinearBuffer, T, SVO, A);
 public:
     Iterator(T* in) noexcept: ptr(in) { }
     Iterator(const Reverse& in) noexcept: ptr(in.it.ptr) { }
@@ -28,23 +28,23 @@ private:
 };
 
 // reverse iterator
-template<typename T, size_t SVO> class Iterator<BWD, LinearBuffer<T, SVO>> {
-    ITERATOR_BODY_REVERSE(LinearBuffer, T, SVO);
+template<typename T, size_t SVO, typename A> class Iterator<BWD, LinearBuffer<T, SVO, A>> {
+    ITERATOR_BODY_REVERSE(LinearBuffer, T, SVO, A);
 public:
     Iterator(T* in) noexcept: it(in) { }
 };
 
-REGISTER_CONST_ITERATOR((typename T, size_t SVO), FWD, LinearBuffer, T, SVO);
-REGISTER_CONST_ITERATOR((typename T, size_t SVO), BWD, LinearBuffer, T, SVO);
+REGISTER_CONST_ITERATOR((typename T, size_t SVO, typename A), FWD, LinearBuffer, T, SVO, A);
+REGISTER_CONST_ITERATOR((typename T, size_t SVO, typename A), BWD, LinearBuffer, T, SVO, A);
 
 /**************************************************************************************************
  * LinearBuffer
  **************************************************************************************************/
 
-template<typename T, size_t N>
+template<typename T, size_t N, typename A>
 template<size_t X, bool COPY>
-bool LinearBuffer<T, N>::ctor(std::conditional_t<COPY, const LinearBuffer<T, X>&, LinearBuffer<T, X>&&> in,
-                              index_t                                                                   begin) {
+bool LinearBuffer<T, N, A>::ctor(std::conditional_t<COPY, const LinearBuffer<T, X, A>&, LinearBuffer<T, X, A>&&> in,
+                                 index_t                                                                         begin) {
     // reset data
     if(counter != 0) {
         clear();
@@ -58,7 +58,7 @@ bool LinearBuffer<T, N>::ctor(std::conditional_t<COPY, const LinearBuffer<T, X>&
         // counter is less than MIN -> unable to move
         if(in.container != in.stack && in.counter > MIN) {
             if(container != stack) {
-                free(container); // free
+                A::deallocate(container); // free
             }
 
             container    = in.container; // move
@@ -77,7 +77,7 @@ bool LinearBuffer<T, N>::ctor(std::conditional_t<COPY, const LinearBuffer<T, X>&
     }
 
     // copy or move
-    transfer<COPY>(in.container, container, begin, in.counter);
+    transfer<COPY>(in.container, container, begin, in.counter, in.capacitor);
 
     // copy or move
     counter = in.counter; // set
@@ -87,72 +87,72 @@ bool LinearBuffer<T, N>::ctor(std::conditional_t<COPY, const LinearBuffer<T, X>&
     return true;
 }
 
-template<typename T, size_t SVO> LinearBuffer<T, SVO>::LinearBuffer(): container(stack) { }
+template<typename T, size_t SVO, typename A> LinearBuffer<T, SVO, A>::LinearBuffer(): container(stack) { }
 
-template<typename T, size_t SVO> LinearBuffer<T, SVO>::~LinearBuffer() {
+template<typename T, size_t SVO, typename A> LinearBuffer<T, SVO, A>::~LinearBuffer() {
     clear();
     if(container != stack) {
-        free(container);
+        A::deallocate(container);
     }
 }
 
-template<typename T, size_t SVO> LinearBuffer<T, SVO>::LinearBuffer(const LinearBuffer& in) {
+template<typename T, size_t SVO, typename A> LinearBuffer<T, SVO, A>::LinearBuffer(const LinearBuffer& in) {
     ctor<SVO, true>(in, 0);
 }
 
-template<typename T, size_t SVO> LinearBuffer<T, SVO>::LinearBuffer(LinearBuffer&& in) noexcept {
+template<typename T, size_t SVO, typename A> LinearBuffer<T, SVO, A>::LinearBuffer(LinearBuffer&& in) noexcept {
     ctor<SVO, false>(std::move(in), 0);
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::operator=(const LinearBuffer& in) -> LinearBuffer& {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::operator=(const LinearBuffer& in) -> LinearBuffer& {
     if(this != &in) {
         ctor<SVO, true>(in, 0);
     }
     return *this;
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::operator=(LinearBuffer&& in) noexcept -> LinearBuffer& {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::operator=(LinearBuffer&& in) noexcept -> LinearBuffer& {
     if(this != &in) {
         ctor<SVO, false>(std::move(in), 0);
     }
     return *this;
 }
 
-template<typename T, size_t SVO> T& LinearBuffer<T, SVO>::operator[](index_t index) noexcept {
+template<typename T, size_t SVO, typename A> T& LinearBuffer<T, SVO, A>::operator[](index_t index) noexcept {
     return container[index];
 }
 
-template<typename T, size_t SVO> const T& LinearBuffer<T, SVO>::operator[](index_t index) const noexcept {
+template<typename T, size_t SVO, typename A> const T& LinearBuffer<T, SVO, A>::operator[](index_t index) const noexcept {
     return container[index];
 }
 
-template<typename T, size_t SVO> template<size_t N> LinearBuffer<T, SVO>::LinearBuffer(const LinearBuffer<T, N>& in) {
+template<typename T, size_t SVO, typename A> template<size_t N> LinearBuffer<T, SVO, A>::LinearBuffer(const LinearBuffer<T, N, A>& in) {
     ctor<N, true>(in, 0);
 }
 
-template<typename T, size_t SVO> template<size_t N> LinearBuffer<T, SVO>::LinearBuffer(
-    LinearBuffer<T, N>&& in) noexcept {
+template<typename T, size_t SVO, typename A> template<size_t N> LinearBuffer<T, SVO, A>::LinearBuffer(
+    LinearBuffer<T, N, A>&& in) noexcept {
     ctor<N, false>(std::move(in), 0);
 }
 
-template<typename T, size_t SVO> template<size_t N> LinearBuffer<T, N>&
-LinearBuffer<T, SVO>::operator=(const LinearBuffer<T, N>& in) {
+template<typename T, size_t SVO, typename A> template<size_t N> LinearBuffer<T, N, A>&
+LinearBuffer<T, SVO, A>::operator=(const LinearBuffer<T, N, A>& in) {
     if(this != &in) {
         ctor<N, true>(in, 0);
     }
     return *this;
 }
 
-template<typename T, size_t SVO> template<size_t N> LinearBuffer<T, N>&
-LinearBuffer<T, SVO>::operator=(LinearBuffer<T, N>&& in) noexcept {
+template<typename T, size_t SVO, typename A> template<size_t N> LinearBuffer<T, N, A>&
+LinearBuffer<T, SVO, A>::operator=(LinearBuffer<T, N, A>&& in) noexcept {
     if(this == &in) {
         ctor<N, false>(std::move(in), 0);
     }
     return *this;
 }
 
-template<typename T, size_t SVO> template<typename Arg>
-bool LinearBuffer<T, SVO>::emplace(index_t index, Arg&& in) noexcept {
+template<typename T, size_t SVO, typename A> template<typename Arg>
+bool LinearBuffer<T, SVO, A>::emplace(index_t index, Arg&& in) noexcept {
     // full, bad alloc
     if(counter == capacitor) {
         size_t n = capacitor ? (capacitor << 1) : config::CAPACITY; // set default
@@ -168,7 +168,7 @@ bool LinearBuffer<T, SVO>::emplace(index_t index, Arg&& in) noexcept {
     return true;
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::erase(index_t index, T* out) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::erase(index_t index, T* out) noexcept {
     if(index < 0 || index >= counter) {
         return false;
     }
@@ -182,28 +182,28 @@ template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::erase(index_t index,
     return true;
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::push() noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::push() noexcept {
     return emplace(counter, T{});
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::push(T&& in) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::push(T&& in) noexcept {
     return emplace(counter, std::move(in));
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::push(const T& in) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::push(const T& in) noexcept {
     return emplace(counter, in);
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::pop(T* out) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::pop(T* out) noexcept {
     return erase(counter - 1, out);
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::pop(T& out) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::pop(T& out) noexcept {
     return erase(counter - 1, &out);
 }
 
-template<typename T, size_t SVO>
-template<typename Arg> bool LinearBuffer<T, SVO>::insert(index_t index, Arg&& in) {
+template<typename T, size_t SVO, typename A>
+template<typename Arg> bool LinearBuffer<T, SVO, A>::insert(index_t index, Arg&& in) {
     if(index < 0) index = 0;
     else if(index >= counter) index = counter;
 
@@ -215,13 +215,9 @@ template<typename Arg> bool LinearBuffer<T, SVO>::insert(index_t index, Arg&& in
         }
     }
 
-    index_t last = 0;
-    if(counter) {
-        last = counter - 1;
-        // swap and insert
-        if(index < last) {
-            new(container + last) T(std::move(container[index])); // move
-        }
+    // swap and insert, item at index to the end
+    if(index < counter) {
+        relocate(container + counter, container + index); // move
     }
 
     // construct
@@ -230,34 +226,33 @@ template<typename Arg> bool LinearBuffer<T, SVO>::insert(index_t index, Arg&& in
     return true;
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::remove(index_t index, T* out) {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::remove(index_t index, T* out) {
     if(counter == 0) {
         return false;
     }
 
     if(index < 0) index = 0;
-    else if(index >= counter) index = counter;
+    else if(index >= counter) index = counter - 1;
 
     if(out) {
         *out = std::move(container[index]); // return
     }
 
     // swap and delete
-    size_t last = counter - 1;
+    index_t last = counter - 1;
+    container[index].~T(); // destruct
     if(index < last) {
-        container[index] = std::move(container[last]); // move
-        container[last].~T();                          // destruct
+        relocate(container + index, container + last); // move
     }
-
-    else container[index].~T(); // destruct
-    --counter;                  // count
+    --counter; // count
+    return true;
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::remove(index_t idx, T& out) {
-    remove(idx, &out);
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::remove(index_t idx, T& out) {
+    return remove(idx, &out);
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::resize(size_t in) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::resize(size_t in) noexcept {
     // reallocate
     if(in > capacitor) {
         if(!reallocate(in)) {
@@ -276,132 +271,132 @@ template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::resize(size_t in) no
     return true;
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::reserve(size_t in) noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::reserve(size_t in) noexcept {
     if(in < capacitor) {
         return true;
     }
     return reallocate(in);
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::compact() noexcept {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::compact() noexcept {
     return reallocate(counter);
 }
 
-template<typename T, size_t SVO> void LinearBuffer<T, SVO>::clear() noexcept {
+template<typename T, size_t SVO, typename A> void LinearBuffer<T, SVO, A>::clear() noexcept {
     for(index_t i = 0; i < counter; ++i) {
         container[i].~T();
     }
     counter = 0;
 }
 
-template<typename T, size_t SVO> size_t LinearBuffer<T, SVO>::size() const noexcept {
+template<typename T, size_t SVO, typename A> size_t LinearBuffer<T, SVO, A>::size() const noexcept {
     return counter;
 }
 
-template<typename T, size_t SVO> size_t LinearBuffer<T, SVO>::capacity() const noexcept {
+template<typename T, size_t SVO, typename A> size_t LinearBuffer<T, SVO, A>::capacity() const noexcept {
     return capacitor;
 }
 
-template<typename T, size_t SVO> inline bool LinearBuffer<T, SVO>::full() const noexcept {
+template<typename T, size_t SVO, typename A> inline bool LinearBuffer<T, SVO, A>::full() const noexcept {
     return counter == capacitor;
 }
 
-template<typename T, size_t SVO> inline bool LinearBuffer<T, SVO>::empty() const noexcept {
+template<typename T, size_t SVO, typename A> inline bool LinearBuffer<T, SVO, A>::empty() const noexcept {
     return counter == 0;
 }
 
-template<typename T, size_t SVO> T* LinearBuffer<T, SVO>::data() noexcept {
+template<typename T, size_t SVO, typename A> T* LinearBuffer<T, SVO, A>::data() noexcept {
     return container;
 }
 
-template<typename T, size_t SVO> const T* LinearBuffer<T, SVO>::data() const noexcept {
+template<typename T, size_t SVO, typename A> const T* LinearBuffer<T, SVO, A>::data() const noexcept {
     return const_cast<LinearBuffer*>(this)->data();
 }
 
-template<typename T, size_t SVO> T& LinearBuffer<T, SVO>::at(index_t in) {
+template<typename T, size_t SVO, typename A> T& LinearBuffer<T, SVO, A>::at(index_t in) {
     if(in < 0 || in >= counter) {
         throw diag::error(diag::OUT_OF_RANGE);
     }
     return container[in];
 }
 
-template<typename T, size_t SVO> const T& LinearBuffer<T, SVO>::at(index_t in) const {
+template<typename T, size_t SVO, typename A> const T& LinearBuffer<T, SVO, A>::at(index_t in) const {
     return const_cast<LinearBuffer*>(this)->at(in);
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::begin() noexcept -> Iterator<FWD> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::begin() noexcept -> Iterator<FWD> {
     return Iterator<FWD | VIEW>{ container };
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::end() noexcept -> Iterator<FWD> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::end() noexcept -> Iterator<FWD> {
     return Iterator<FWD | VIEW>{ container + counter }; // overflow safe: bitwise
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::rbegin() noexcept -> Iterator<BWD> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::rbegin() noexcept -> Iterator<BWD> {
     return Iterator<BWD | VIEW>{ container + counter - 1 }; // overflow safe: bitwise
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::rend() noexcept -> Iterator<BWD> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::rend() noexcept -> Iterator<BWD> {
     return Iterator<BWD | VIEW>{ container - 1 };
 }
 
-template<typename T, size_t SVO> T* LinearBuffer<T, SVO>::front() noexcept {
+template<typename T, size_t SVO, typename A> T* LinearBuffer<T, SVO, A>::front() noexcept {
     return Iterator<FWD | VIEW>{ begin() };
 }
 
-template<typename T, size_t SVO> T* LinearBuffer<T, SVO>::rear() noexcept {
+template<typename T, size_t SVO, typename A> T* LinearBuffer<T, SVO, A>::rear() noexcept {
     return Iterator<BWD | VIEW>{ rbegin() };
 }
 
-template<typename T, size_t SVO> T* LinearBuffer<T, SVO>::top() noexcept {
+template<typename T, size_t SVO, typename A> T* LinearBuffer<T, SVO, A>::top() noexcept {
     return Iterator<BWD | VIEW>{ rbegin() };
 }
 
-template<typename T, size_t SVO> T* LinearBuffer<T, SVO>::bottom() noexcept {
+template<typename T, size_t SVO, typename A> T* LinearBuffer<T, SVO, A>::bottom() noexcept {
     return Iterator<FWD | VIEW>{ begin() };
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::begin() const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<LinearBuffer*>(this)->begin();
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::end() const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::end() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<LinearBuffer*>(this)->end();
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::rbegin() const noexcept -> Iterator<BWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::rbegin() const noexcept -> Iterator<BWD | VIEW> {
     return const_cast<LinearBuffer*>(this)->rbegin();
 }
 
-template<typename T, size_t SVO> auto LinearBuffer<T, SVO>::rend() const noexcept -> Iterator<BWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto LinearBuffer<T, SVO, A>::rend() const noexcept -> Iterator<BWD | VIEW> {
     return const_cast<LinearBuffer*>(this)->rend();
 }
 
-template<typename T, size_t SVO> const T* LinearBuffer<T, SVO>::front() const noexcept {
+template<typename T, size_t SVO, typename A> const T* LinearBuffer<T, SVO, A>::front() const noexcept {
     return const_cast<LinearBuffer*>(this)->front();
 }
 
-template<typename T, size_t SVO> const T* LinearBuffer<T, SVO>::rear() const noexcept {
+template<typename T, size_t SVO, typename A> const T* LinearBuffer<T, SVO, A>::rear() const noexcept {
     return const_cast<LinearBuffer*>(this)->rear();
 }
 
-template<typename T, size_t SVO> const T* LinearBuffer<T, SVO>::top() const noexcept {
+template<typename T, size_t SVO, typename A> const T* LinearBuffer<T, SVO, A>::top() const noexcept {
     return const_cast<LinearBuffer*>(this)->top();
 }
 
-template<typename T, size_t SVO> const T* LinearBuffer<T, SVO>::bottom() const noexcept {
+template<typename T, size_t SVO, typename A> const T* LinearBuffer<T, SVO, A>::bottom() const noexcept {
     return const_cast<LinearBuffer*>(this)->bottom();
 }
 
-template<typename T, size_t SVO> template<typename U> void LinearBuffer<T, SVO>::push_back(U&& in) {
+template<typename T, size_t SVO, typename A> template<typename U> void LinearBuffer<T, SVO, A>::push_back(U&& in) {
     push(std::forward<U>(in));
 }
 
-template<typename T, size_t SVO> void LinearBuffer<T, SVO>::pop_back() {
+template<typename T, size_t SVO, typename A> void LinearBuffer<T, SVO, A>::pop_back() {
     pop();
 }
 
-template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::reallocate(size_t in, index_t begin) {
+template<typename T, size_t SVO, typename A> bool LinearBuffer<T, SVO, A>::reallocate(size_t in, index_t begin) {
     // adjust and check
     if(in < MIN) in = MIN; // set MIN
     else if((in = align(in)) > INT64_MAX) {
@@ -409,50 +404,88 @@ template<typename T, size_t SVO> bool LinearBuffer<T, SVO>::reallocate(size_t in
     }
     if(in == capacitor) return true;
 
+    // relocatable: heap to heap by realloc, in place or one copy of bytes
+    if constexpr(Relocatable<T>::value && mem::Resizable<A>::value) {
+        if(container != stack && in > MIN && begin == 0) {
+            T* newly = static_cast<T*>(A::reallocate(container, sizeof(T) * in));
+            if(newly == nullptr) {
+                return false; // failed, container is kept
+            }
+            container = newly;
+            capacitor = in;
+            return true;
+        }
+    }
+
     T* newly = stack; // init
     if(in > MIN) {
-        if((newly = static_cast<T*>(malloc(sizeof(T) * in))) == nullptr) {
+        if((newly = static_cast<T*>(A::allocate(sizeof(T) * in))) == nullptr) {
             return false; // failed
         }
     }
 
     // move
     if(counter) {
-        transfer<false>(container, newly, begin, counter);
+        transfer<false>(container, newly, begin, counter, capacitor);
     }
 
     // release
     if(container != stack) {
-        std::free(container);
+        A::deallocate(container);
     }
     container = newly;
     capacitor = in;
     return true;
 }
 
-template<typename T, size_t SVO>
-template<bool COPY> void LinearBuffer<T, SVO>::transfer(const T* in, T* out, index_t begin, size_t size) {
+template<typename T, size_t SVO, typename A>
+template<bool COPY>
+void LinearBuffer<T, SVO, A>::transfer(const T* in, T* out, index_t begin, size_t size, size_t capacity) {
     // logic for cirulation ...
     size_t adjust    = size < capacitor ? size : capacitor;    // set for reduce
-    size_t length    = size - begin;                           // begin ~ end
+    size_t length    = capacity - begin;                       // begin ~ source end
     size_t current   = adjust <= length ? adjust : length;     // begin ~ end size
     size_t remainder = adjust <= length ? 0 : adjust - length; // 0 ~ begin size
 
+    // move: source is destroyed here, const T&& would copy
+    T* from = const_cast<T*>(in);
+
+    // bytes: copy of trivially copyable, move of relocatable
+    if constexpr(COPY ? std::is_trivially_copyable_v<T> : Relocatable<T>::value) {
+        if(current) std::memcpy(out, from + begin, current * sizeof(T));
+        if(remainder) std::memcpy(out + current, from, remainder * sizeof(T)); // continue
+        return;
+    }
+
     for(size_t i = 0; i < current; ++i) {
         if constexpr(!COPY) {
-            new(out + i) T{ std::move(in[begin + i]) };
+            new(out + i) T{ std::move(from[begin + i]) };
+            from[begin + i].~T();
         }
         else new(out + i) T{ in[begin + i] };
     }
     for(size_t i = 0; i < remainder; ++i) {
         if constexpr(!COPY) {
-            new(out + current + i) T{ std::move(in[i]) }; // continue
+            new(out + current + i) T{ std::move(from[i]) }; // continue
+            from[i].~T();
         }
         else new(out + current + i) T{ in[i] }; // continue
     }
 }
 
-template<typename T, size_t SVO> void LinearBuffer<T, SVO>::clear(size_t begin) {
+template<typename T, size_t SVO, typename A> void LinearBuffer<T, SVO, A>::relocate(T* out, T* in, size_t n) noexcept {
+    if constexpr(Relocatable<T>::value) {
+        std::memmove(out, in, n * sizeof(T)); // overlap safe
+    }
+    else {
+        for(size_t i = 0; i < n; ++i) {
+            new(out + i) T(std::move(in[i]));
+            in[i].~T();
+        }
+    }
+}
+
+template<typename T, size_t SVO, typename A> void LinearBuffer<T, SVO, A>::clear(size_t begin) {
     if(begin == 0) {
         clear();
         return;
@@ -25,6 +25,8 @@
     in: 7 -> process [4] ... out of range
     in: 8 -> out of range
 
+    growth: see LinearBuffer, relocatable T is moved by memcpy or realloc (head is 0)
+
     ! SWAP AND DELETE / INSERT !
     e.g.
     +--------------------+
@@ -62,24 +64,27 @@
 
 LWE_BEGIN
 namespace container {
-template<typename T, size_t SVO = 0> class RingBuffer {
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, size_t SVO = 0, typename A = mem::System> class RingBuffer {
 
 public:
-    CONTAINER_BODY(RingBuffer, T, T, SVO);
-    using Stack = LinearBuffer<T, SVO>;
+    CONTAINER_BODY(RingBuffer, T, T, SVO, A);
+    using Stack     = LinearBuffer<T, SVO, A>;
+    using Allocator = A;
 
 public:
     RingBuffer() = default;
+    ~RingBuffer(); //!< destroy from head, wrapped
     RingBuffer(const RingBuffer&);
     RingBuffer(RingBuffer&&) noexcept;
     RingBuffer& operator=(const RingBuffer&);
     RingBuffer& operator=(RingBuffer&&) noexcept;
 
 public:
-    template<size_t X> RingBuffer(const RingBuffer<T, X>&);
-    template<size_t X> RingBuffer(RingBuffer<T, X>&&) noexcept;
-    template<size_t X> RingBuffer& operator=(const RingBuffer<T, X>&);
-    template<size_t X> RingBuffer& operator=(RingBuffer<T, X>&&) noexcept;
+    template<size_t X> RingBuffer(const RingBuffer<T, X, A>&);
+    template<size_t X> RingBuffer(RingBuffer<T, X, A>&&) noexcept;
+    template<size_t X> RingBuffer& operator=(const RingBuffer<T, X, A>&);
+    template<size_t X> RingBuffer& operator=(RingBuffer<T, X, A>&&) noexcept;
 
 public:
     T&       operator[](size_t);
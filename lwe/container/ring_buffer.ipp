@@ -1,8 +1,8 @@
 LWE_BEGIN
 namespace container {
 
-template<typename T, size_t SVO> class Iterator<FWD, RingBuffer<T, SVO>> {
-    ITERATOR_BODY(FWD, RingBuffer, T, SVO);
+template<typename T, size_t SVO, typename A> class Iterator<FWD, RingBuffer<T, SVO, A>> {
+    ITERATOR_BODY(FWD, RingBuffer, T, SVO, A);
 public:
     Iterator(T* container, index_t index, size_t capacity) noexcept: ptr(container), idx(index), cap(capacity) { }
     Iterator(const Reverse& in) noexcept: Iterator(in.it) { }
@@ -25,40 +25,44 @@ private:
     size_t  cap;
 };
 
-template<typename T, size_t SVO> class Iterator<BWD, RingBuffer<T, SVO>> {
-    ITERATOR_BODY_REVERSE(RingBuffer, T, SVO);
+template<typename T, size_t SVO, typename A> class Iterator<BWD, RingBuffer<T, SVO, A>> {
+    ITERATOR_BODY_REVERSE(RingBuffer, T, SVO, A);
 public:
     Iterator(T* container, index_t index, size_t capacity) noexcept: it(container, index, capacity) { }
 };
 
-REGISTER_CONST_ITERATOR((typename T, size_t SVO), FWD, RingBuffer, T, SVO);
-REGISTER_CONST_ITERATOR((typename T, size_t SVO), BWD, RingBuffer, T, SVO);
+REGISTER_CONST_ITERATOR((typename T, size_t SVO, typename A), FWD, RingBuffer, T, SVO, A);
+REGISTER_CONST_ITERATOR((typename T, size_t SVO, typename A), BWD, RingBuffer, T, SVO, A);
 
-template<typename T, size_t SVO> index_t RingBuffer<T, SVO>::absidx(index_t in) const noexcept {
+template<typename T, size_t SVO, typename A> index_t RingBuffer<T, SVO, A>::absidx(index_t in) const noexcept {
     return (in) & (stack.capacitor - 1);
 }
 
-template<typename T, size_t SVO> index_t RingBuffer<T, SVO>::relidx(index_t in) const noexcept {
+template<typename T, size_t SVO, typename A> index_t RingBuffer<T, SVO, A>::relidx(index_t in) const noexcept {
     return (head + in) & (stack.capacitor - 1);
 }
 
-template<typename T, size_t SVO> RingBuffer<T, SVO>::RingBuffer(const RingBuffer& in) {
+template<typename T, size_t SVO, typename A> RingBuffer<T, SVO, A>::~RingBuffer() {
+    clear(); // stack destroys [0, counter), not the ring
+}
+
+template<typename T, size_t SVO, typename A> RingBuffer<T, SVO, A>::RingBuffer(const RingBuffer& in) {
     stack.ctor<SVO, true>(in.stack, in.head);
 }
 
-template<typename T, size_t SVO> RingBuffer<T, SVO>::RingBuffer(RingBuffer&& in) noexcept {
+template<typename T, size_t SVO, typename A> RingBuffer<T, SVO, A>::RingBuffer(RingBuffer&& in) noexcept {
     stack.ctor<SVO, false>(std::move(in.stack), in.head);
     in.clear();
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::operator=(const RingBuffer& in) -> RingBuffer& {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::operator=(const RingBuffer& in) -> RingBuffer& {
     if(this != &in) {
         stack.ctor<SVO, true>(in.stack, in.head);
     }
     return *this;
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::operator=(RingBuffer&& in) noexcept -> RingBuffer& {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::operator=(RingBuffer&& in) noexcept -> RingBuffer& {
     if(this != &in) {
         stack.ctor<SVO, false>(std::move(in.stack), in.head);
         in.clear();
@@ -66,27 +70,27 @@ template<typename T, size_t SVO> auto RingBuffer<T, SVO>::operator=(RingBuffer&&
     return *this;
 }
 
-template<typename T, size_t SVO>
-template<size_t X> RingBuffer<T, SVO>::RingBuffer(const RingBuffer<T, X>& in) {
+template<typename T, size_t SVO, typename A>
+template<size_t X> RingBuffer<T, SVO, A>::RingBuffer(const RingBuffer<T, X, A>& in) {
     stack.ctor<SVO, true>(in.stack, in.head);
 }
 
-template<typename T, size_t SVO>
-template<size_t X> RingBuffer<T, SVO>::RingBuffer(RingBuffer<T, X>&& in) noexcept {
+template<typename T, size_t SVO, typename A>
+template<size_t X> RingBuffer<T, SVO, A>::RingBuffer(RingBuffer<T, X, A>&& in) noexcept {
     stack.ctor<SVO, false>(std::move(in.stack), in.head);
     in.clear();
 }
 
-template<typename T, size_t SVO>
-template<size_t X> auto RingBuffer<T, SVO>::operator=(const RingBuffer<T, X>& in) -> RingBuffer& {
+template<typename T, size_t SVO, typename A>
+template<size_t X> auto RingBuffer<T, SVO, A>::operator=(const RingBuffer<T, X, A>& in) -> RingBuffer& {
     if(this != &in) {
         stack.ctor<SVO, true>(in.stack, in.head);
     }
     return *this;
 }
 
-template<typename T, size_t SVO>
-template<size_t X> auto RingBuffer<T, SVO>::operator=(RingBuffer<T, X>&& in) noexcept -> RingBuffer& {
+template<typename T, size_t SVO, typename A>
+template<size_t X> auto RingBuffer<T, SVO, A>::operator=(RingBuffer<T, X, A>&& in) noexcept -> RingBuffer& {
     if(this != &in) {
         stack.ctor<SVO, false>(std::move(in.stack), in.head);
         in.clear();
@@ -94,16 +98,16 @@ template<size_t X> auto RingBuffer<T, SVO>::operator=(RingBuffer<T, X>&& in) noe
     return *this;
 }
 
-template<typename T, size_t SVO> T& RingBuffer<T, SVO>::operator[](size_t idx) {
+template<typename T, size_t SVO, typename A> T& RingBuffer<T, SVO, A>::operator[](size_t idx) {
     idx = relidx(idx);
     return stack.container[idx];
 }
 
-template<typename T, size_t SVO> const T& RingBuffer<T, SVO>::operator[](size_t idx) const {
+template<typename T, size_t SVO, typename A> const T& RingBuffer<T, SVO, A>::operator[](size_t idx) const {
     return const_cast<RingBuffer*>(this)->operator[](idx);
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::push(const T& in) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::push(const T& in) {
     if(!emplace(tail, in)) {
         return false;
     }
@@ -111,7 +115,7 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::push(const T& in) {
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::push(T&& in) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::push(T&& in) {
     if(!emplace(tail, std::move(in))) {
         return false;
     }
@@ -119,11 +123,11 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::push(T&& in) {
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::push() {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::push() {
     return push(T{});
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::pop(T* out) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::pop(T* out) {
     index_t prev = absidx(tail - 1); // befre
     if(!erase(prev, out)) {
         return false;
@@ -132,12 +136,19 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::pop(T* out) {
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::pop(T& out) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::pop(T& out) {
     return pop(&out);
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::prepend(const T& in) {
-    index_t next = stack.capacitor ? absidx(head - 1) : 0; // before (head - 1) % cap
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::prepend(const T& in) {
+    // full -> reallocate first, head to 0, before index is taken
+    if(stack.counter == stack.capacitor) {
+        if(!reallocate(stack.capacitor ? (stack.capacitor << 1) : config::CAPACITY)) {
+            return false; // bad alloc
+        }
+    }
+
+    index_t next = absidx(head - 1); // before (head - 1) % cap
     if(!emplace(next, in)) {
         return false;
     }
@@ -145,8 +156,15 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::prepend(const T& in) {
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::prepend(T&& in) {
-    index_t next = stack.capacitor ? absidx(head - 1) : 0; // before (head - 1) % cap
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::prepend(T&& in) {
+    // full -> reallocate first, head to 0, before index is taken
+    if(stack.counter == stack.capacitor) {
+        if(!reallocate(stack.capacitor ? (stack.capacitor << 1) : config::CAPACITY)) {
+            return false; // bad alloc
+        }
+    }
+
+    index_t next = absidx(head - 1); // before (head - 1) % cap
     if(!emplace(next, std::move(in))) {
         return false;
     }
@@ -154,12 +172,12 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::prepend(T&& in) {
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::prepend() {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::prepend() {
     return prepend(T{});
 }
 
-template<typename T, size_t SVO>
-bool RingBuffer<T, SVO>::pull(T* out) {
+template<typename T, size_t SVO, typename A>
+bool RingBuffer<T, SVO, A>::pull(T* out) {
     if(!erase(head, out)) {
         return false;
     }
@@ -167,20 +185,20 @@ bool RingBuffer<T, SVO>::pull(T* out) {
     return true;
 }
 
-template<typename T, size_t SVO>
-bool RingBuffer<T, SVO>::pull(T& out) {
+template<typename T, size_t SVO, typename A>
+bool RingBuffer<T, SVO, A>::pull(T& out) {
     return pull(&out);
 }
 
-template<typename T, size_t SVO>
-template<typename Arg> bool RingBuffer<T, SVO>::insert(index_t index, Arg&& in) {
+template<typename T, size_t SVO, typename A>
+template<typename Arg> bool RingBuffer<T, SVO, A>::insert(index_t index, Arg&& in) {
     // adjust
     if(index < 0) index = -1;
     else if(index > stack.counter) index = stack.counter;
 
-    // full -> allocate (for swap)
+    // full -> reallocate (for swap), head to 0
     if(stack.counter == stack.capacitor) {
-        if(!stack.allocate(stack.capacitor << 1, head)) {
+        if(!reallocate(stack.capacitor ? (stack.capacitor << 1) : config::CAPACITY)) {
             return false; // bad alloc
         }
     }
@@ -190,16 +208,17 @@ template<typename Arg> bool RingBuffer<T, SVO>::insert(index_t index, Arg&& in)
 
     // swap
     if(index >= 0 && index < stack.counter) {
-        new(stack.container + tail) T(std::move(stack.container[rel])); // move
-        stack.container[rel].~T();                                      // destruct
+        Stack::relocate(stack.container + tail, stack.container + rel); // move and destruct
     }
 
     // and insert
     emplace(rel, std::forward<Arg>(in));
+    if(index < 0) head = rel;     // front
+    else tail = absidx(tail + 1); // swapped or appended to tail
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::remove(index_t index, T* out) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::remove(index_t index, T* out) {
     if(stack.counter == 0) {
         return false;
     }
@@ -231,11 +250,11 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::remove(index_t index,
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::remove(index_t index, T& out) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::remove(index_t index, T& out) {
     remove(index, &out);
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::resize(size_t in) noexcept {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::resize(size_t in) noexcept {
     // reallocate
     if(in > stack.capacitor) {
         if(!reallocate(in)) {
@@ -255,18 +274,18 @@ template<typename T, size_t SVO> bool RingBuffer<T, SVO>::resize(size_t in) noex
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::reserve(size_t in) noexcept {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::reserve(size_t in) noexcept {
     if(in < stack.capacitor) {
         return true;
     }
     return reallocate(in);
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::compact() noexcept {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::compact() noexcept {
     return reallocate(stack.counter);
 }
 
-template<typename T, size_t SVO> void RingBuffer<T, SVO>::clear() noexcept {
+template<typename T, size_t SVO, typename A> void RingBuffer<T, SVO, A>::clear() noexcept {
     for(index_t i = 0; i < stack.counter; ++i) {
         stack.container[head].~T(); // delete
         head = absidx(head + 1);    // move
@@ -276,46 +295,46 @@ template<typename T, size_t SVO> void RingBuffer<T, SVO>::clear() noexcept {
     tail          = 0; // init
 }
 
-template<typename T, size_t SVO> size_t RingBuffer<T, SVO>::size() const noexcept {
+template<typename T, size_t SVO, typename A> size_t RingBuffer<T, SVO, A>::size() const noexcept {
     return stack.counter;
 }
 
-template<typename T, size_t SVO> size_t RingBuffer<T, SVO>::capacity() const noexcept {
+template<typename T, size_t SVO, typename A> size_t RingBuffer<T, SVO, A>::capacity() const noexcept {
     return stack.capacitor;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::full() const noexcept {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::full() const noexcept {
     return stack.counter == stack.capacitor;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::empty() const noexcept {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::empty() const noexcept {
     return stack.counter == 0;
 }
 
-template<typename T, size_t SVO> T* RingBuffer<T, SVO>::data() noexcept {
+template<typename T, size_t SVO, typename A> T* RingBuffer<T, SVO, A>::data() noexcept {
     return stack.container;
 }
 
-template<typename T, size_t SVO> const T* RingBuffer<T, SVO>::data() const noexcept {
+template<typename T, size_t SVO, typename A> const T* RingBuffer<T, SVO, A>::data() const noexcept {
     return const_cast<RingBuffer*>(this)->data();
 }
 
-template<typename T, size_t SVO> T& RingBuffer<T, SVO>::at(index_t in) {
+template<typename T, size_t SVO, typename A> T& RingBuffer<T, SVO, A>::at(index_t in) {
     if(in < 0 || in >= stack.counter) {
         throw diag::error(diag::OUT_OF_RANGE);
     }
     return stack.container[relidx(in)];
 }
 
-template<typename T, size_t SVO> const T& RingBuffer<T, SVO>::at(index_t in) const {
+template<typename T, size_t SVO, typename A> const T& RingBuffer<T, SVO, A>::at(index_t in) const {
     return const_cast<RingBuffer*>(this)->at(in);
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::begin() noexcept -> Iterator<FWD> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::begin() noexcept -> Iterator<FWD> {
     return Iterator<FWD>(stack.container, head, stack.capacitor);
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::end() noexcept -> Iterator<FWD> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::end() noexcept -> Iterator<FWD> {
     index_t last = tail;
     if(tail <= head && stack.counter) {
         last += stack.capacitor; // circulation -> unfold
@@ -323,7 +342,7 @@ template<typename T, size_t SVO> auto RingBuffer<T, SVO>::end() noexcept -> Iter
     return Iterator<FWD>(stack.container, last, stack.capacitor);
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::rbegin() noexcept -> Iterator<BWD> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::rbegin() noexcept -> Iterator<BWD> {
     index_t last = tail - 1;
     if(tail <= head && stack.counter) {
         last += (stack.capacitor); // circulation -> unfold
@@ -331,76 +350,76 @@ template<typename T, size_t SVO> auto RingBuffer<T, SVO>::rbegin() noexcept -> I
     return Iterator<BWD>(stack.container, last, stack.capacitor);
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::rend() noexcept -> Iterator<BWD> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::rend() noexcept -> Iterator<BWD> {
     return Iterator<FWD>(stack.container, head - 1, stack.capacitor);
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::begin() const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<RingBuffer*>(this)->begin();
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::end() const noexcept -> Iterator<FWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::end() const noexcept -> Iterator<FWD | VIEW> {
     return const_cast<RingBuffer*>(this)->end();
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::rbegin() const noexcept -> Iterator<BWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::rbegin() const noexcept -> Iterator<BWD | VIEW> {
     return const_cast<RingBuffer*>(this)->rbegin();
 }
 
-template<typename T, size_t SVO> auto RingBuffer<T, SVO>::rend() const noexcept -> Iterator<BWD | VIEW> {
+template<typename T, size_t SVO, typename A> auto RingBuffer<T, SVO, A>::rend() const noexcept -> Iterator<BWD | VIEW> {
     return const_cast<RingBuffer*>(this)->rend();
 }
 
-template<typename T, size_t SVO> T* RingBuffer<T, SVO>::front() noexcept {
+template<typename T, size_t SVO, typename A> T* RingBuffer<T, SVO, A>::front() noexcept {
     return stack.front();
 }
 
-template<typename T, size_t SVO> T* RingBuffer<T, SVO>::rear() noexcept {
+template<typename T, size_t SVO, typename A> T* RingBuffer<T, SVO, A>::rear() noexcept {
     return stack.rear();
 }
 
-template<typename T, size_t SVO> T* RingBuffer<T, SVO>::top() noexcept {
+template<typename T, size_t SVO, typename A> T* RingBuffer<T, SVO, A>::top() noexcept {
     return stack.top();
 }
 
-template<typename T, size_t SVO> T* RingBuffer<T, SVO>::bottom() noexcept {
+template<typename T, size_t SVO, typename A> T* RingBuffer<T, SVO, A>::bottom() noexcept {
     return stack.bottom();
 }
 
-template<typename T, size_t SVO> const T* RingBuffer<T, SVO>::front() const noexcept {
+template<typename T, size_t SVO, typename A> const T* RingBuffer<T, SVO, A>::front() const noexcept {
     return stack.front();
 }
 
-template<typename T, size_t SVO> const T* RingBuffer<T, SVO>::rear() const noexcept {
+template<typename T, size_t SVO, typename A> const T* RingBuffer<T, SVO, A>::rear() const noexcept {
     return stack.rear();
 }
 
-template<typename T, size_t SVO> const T* RingBuffer<T, SVO>::top() const noexcept {
+template<typename T, size_t SVO, typename A> const T* RingBuffer<T, SVO, A>::top() const noexcept {
     return stack.top();
 }
 
-template<typename T, size_t SVO> const T* RingBuffer<T, SVO>::bottom() const noexcept {
+template<typename T, size_t SVO, typename A> const T* RingBuffer<T, SVO, A>::bottom() const noexcept {
     return stack.bottom();
 }
 
-template<typename T, size_t SVO> template<typename U> void RingBuffer<T, SVO>::push_back(U&& in) {
+template<typename T, size_t SVO, typename A> template<typename U> void RingBuffer<T, SVO, A>::push_back(U&& in) {
     push(std::forward<U>(in));
 }
 
-template<typename T, size_t SVO> void RingBuffer<T, SVO>::pop_back() {
+template<typename T, size_t SVO, typename A> void RingBuffer<T, SVO, A>::pop_back() {
     pop();
 }
 
-template<typename T, size_t SVO> template<typename U> void RingBuffer<T, SVO>::push_front(U&& in) {
+template<typename T, size_t SVO, typename A> template<typename U> void RingBuffer<T, SVO, A>::push_front(U&& in) {
     prepend(std::forward<U>(in));
 }
 
-template<typename T, size_t SVO> void RingBuffer<T, SVO>::pop_front() {
+template<typename T, size_t SVO, typename A> void RingBuffer<T, SVO, A>::pop_front() {
     pull();
 }
 
-template<typename T, size_t SVO>
-template<typename Arg> bool RingBuffer<T, SVO>::emplace(index_t index, Arg&& in) {
+template<typename T, size_t SVO, typename A>
+template<typename Arg> bool RingBuffer<T, SVO, A>::emplace(index_t index, Arg&& in) {
     // full -> reallocate
     if(stack.counter == stack.capacitor) {
         size_t newcap = config::CAPACITY; // default
@@ -428,8 +447,8 @@ template<typename Arg> bool RingBuffer<T, SVO>::emplace(index_t index, Arg&& in)
     return true;
 }
 
-template<typename T, size_t SVO>
-bool RingBuffer<T, SVO>::erase(index_t index, T* out) {
+template<typename T, size_t SVO, typename A>
+bool RingBuffer<T, SVO, A>::erase(index_t index, T* out) {
     if(stack.counter == 0) {
         return false; // failed
     }
@@ -445,7 +464,7 @@ bool RingBuffer<T, SVO>::erase(index_t index, T* out) {
     return true;
 }
 
-template<typename T, size_t SVO> bool RingBuffer<T, SVO>::reallocate(size_t size) {
+template<typename T, size_t SVO, typename A> bool RingBuffer<T, SVO, A>::reallocate(size_t size) {
     if(!stack.reallocate(size, head)) {
         return false;
     }
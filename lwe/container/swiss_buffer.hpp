@@ -0,0 +1,178 @@
+/**************************************************************************************************
+ * HASH SET with open addressing (swiss table, 1 byte control + SIMD group probing)
+ *
+ * hashing
+ * - hash  -> util::Hash<T>, stored in slot (no rehash of data on grow)
+ * - mixed -> hash * Fibonacci prime
+ * - home  -> top log2(capacity) bits of mixed
+ * - tag   -> next 7 bits of mixed, stored in control byte
+ *
+ * memory layout (one allocation)
+ *   +------+------+------+-- ... --+------+   +----+----+----+-- ... --+----+----+-- ... --+
+ *   | slot | slot | slot |         | slot |   | c0 | c1 | c2 |         | cN | c0 | ... c14 |
+ *   +------+------+------+-- ... --+------+   +----+----+----+-- ... --+----+----+-- ... --+
+ *    data + hash, capacity is power of 2         control bytes            clone of first 15
+ *
+ * control byte
+ *  0xxx xxxx -> full, x: tag
+ *  1000 0000 -> empty
+ *  1111 1110 -> deleted (tombstone)
+ *
+ * probing
+ *  - load 16 control bytes from home, compare tag to all at once (SSE2, scalar fallback)
+ *  - candidate bits -> compare hash and data
+ *  - group has empty -> not found, else next group (triangular: +16, +32, +48 ...)
+ *  - clone bytes let a group cross the end without wrapping
+ *
+ * erase
+ *  - empty when no probe sequence can pass through the slot, else tombstone
+ *  - tombstones are dropped on rehash, same capacity rehash when they take the growth
+ *
+ * NOTE: load factor is capped to 7/8.
+ * NOTE: iteration order is slot order, not insertion order.
+ **************************************************************************************************/
+
+#ifndef LWE_CONTAINER_SWISS_BUFFER
+#define LWE_CONTAINER_SWISS_BUFFER
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../util/hash.hpp"
+#include "../mem/system.hpp"
+#include "iterator.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define LWE_SSE2
+#    include <emmintrin.h>
+#endif
+#if COMPILER == MSVC
+#    include <intrin.h>
+#endif
+
+LWE_BEGIN
+namespace async {
+class Worker; //!< bulk build, see async/worker.hpp
+} // namespace async
+
+namespace container {
+
+//! @tparam A allocator policy, see mem/system.hpp
+template<typename T, typename A = mem::System> class SwissBuffer {
+public:
+    template<typename, typename, typename> friend class SwissTable; //!< for composition
+
+public:
+    CONTAINER_BODY(SwissBuffer, T, T, A);
+    using Allocator = A;
+
+private:
+    struct Slot {
+        T      data; // data
+        hash_t hash; // calculated hash
+    };
+
+    //! @brief 16 control bytes
+    struct Group {
+        static constexpr size_t SIZE = 16;
+
+        using Mask = uint32_t; //!< 1 bit per slot
+
+        static Mask match(const int8_t*, int8_t) noexcept; //!< tag equal
+        static Mask empty(const int8_t*) noexcept;         //!< empty
+        static Mask vacant(const int8_t*) noexcept;        //!< empty or deleted
+        static int  first(Mask) noexcept;                  //!< lowest bit index
+        static int  last(Mask) noexcept;                   //!< highest bit index
+    };
+
+    static constexpr int8_t EMPTY   = -128; //!< 0b1000'0000
+    static constexpr int8_t DELETED = -2;   //!< 0b1111'1110
+    static constexpr size_t NONE    = ~size_t(0);
+
+public:
+    //! @brief constructor
+    //! @param [in] factor: load factor, max 0.875
+    SwissBuffer(float factor = config::LOADFACTOR);
+
+public:
+    ~SwissBuffer();                                 //!< free
+    SwissBuffer(const SwissBuffer&);                //!< deep copy
+    SwissBuffer(SwissBuffer&&) noexcept;            //!< move
+    SwissBuffer& operator=(const SwissBuffer&);     //!< deep copy
+    SwissBuffer& operator=(SwissBuffer&&) noexcept; //!< move
+
+public:
+    bool push(T&&);                      //!< push
+    bool push(const T&);                 //!< push
+    bool pop(const T&) noexcept;         //!< pop
+    bool exist(const T&) const noexcept; //!< check data
+
+public:
+    template<typename U> bool insert(U&&);                          //!< insert
+    bool                      erase(const Iterator<FWD>&) noexcept; //!< iterator erase
+
+public:
+    size_t size() const noexcept;     //!< element count
+    size_t capacity() const noexcept; //!< slot count
+
+public:
+    bool reserve(size_t) noexcept; //!< reserve slots for count, power of 2
+    void clear() noexcept;         //!< clear, but no shrink
+
+public:
+    //! @brief bulk build, sizes the table once
+    //! @param [in] in: data array, moved out when inserted
+    //! @param [in] n: data count
+    //! @param [in] worker: unused, probe sequences cross any bucket partition
+    //! @return false: bad alloc
+    template<typename W = async::Worker> bool build(T*, size_t, W* = nullptr);
+
+public:
+    Iterator<FWD> find(const T&) noexcept; //!< find by data
+    Iterator<FWD> at(size_t) noexcept;     //!< find by order
+    Iterator<FWD> begin() noexcept;        //!< get begin
+    Iterator<FWD> end() noexcept;          //!< get end
+
+public:
+    Iterator<FWD | VIEW> find(const T&) const noexcept; //!< find by data const
+    Iterator<FWD | VIEW> at(size_t) const noexcept;     //!< find by order const
+    Iterator<FWD | VIEW> begin() const noexcept;        //!< get begin const
+    Iterator<FWD | VIEW> end() const noexcept;          //!< get end const
+
+private:
+    template<typename F> size_t probe(hash_t, F&&) const noexcept; //!< index of matched, NONE: not found
+    size_t                      vacant(hash_t) const noexcept;     //!< first empty or deleted in probe sequence
+    size_t                      next(size_t) const noexcept;       //!< next full index from, capacitor: end
+
+private:
+    template<typename U> bool emplace(U&&, hash_t); //!< push detail, no duplicate check
+    void                      remove(size_t);       //!< pop detail
+
+private:
+    bool rehash(size_t);                //!< slot resize, same size: drop tombstones
+    void mark(size_t, int8_t) noexcept; //!< set control byte and clone
+
+private:
+    size_t home(hash_t) const noexcept; //!< first probe index
+    int8_t tag(hash_t) const noexcept;  //!< 7 bits control tag
+
+private:
+    size_t limit(size_t) const noexcept; //!< max element count of capacity
+
+private:
+    size_t counter   = 0; //!< element counter
+    size_t capacitor = 0; //!< slot counter
+    size_t growth    = 0; //!< insertable count before rehash, tombstones take it
+    size_t log       = 0; //!< log2(capacitor)
+
+private:
+    Slot*   slots = nullptr;
+    int8_t* ctrl  = nullptr;
+
+public:
+    const float LOAD_FACTOR;
+};
+
+} // namespace container
+LWE_END
+#include "swiss_buffer.ipp"
+#endif
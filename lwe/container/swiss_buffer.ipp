@@ -0,0 +1,493 @@
+LWE_BEGIN
+namespace container {
+/**************************************************************************************************
+ * Iterator
+ **************************************************************************************************/
+REGISTER_CONST_ITERATOR((typename T, typename A), FWD, SwissBuffer, T, A);
+
+template<typename T, typename A> class Iterator<FWD, SwissBuffer<T, A>> {
+    ITERATOR_BODY(FWD, SwissBuffer, T, A);
+    friend SwissBuffer; //!< erase
+
+public:
+    Iterator(SwissBuffer* self, size_t index): self(self), index(index) { }
+
+public:
+    Iterator& operator++() {
+        if(index != self->capacitor) {
+            index = self->next(index + 1);
+        }
+        return *this;
+    }
+
+    Iterator& operator--() {
+        for(size_t i = index; i > 0; --i) {
+            if(self->ctrl[i - 1] >= 0) {
+                index = i - 1; // full
+                break;
+            }
+        }
+        return *this;
+    }
+
+public:
+    T& operator*() { return self->slots[index].data; }
+
+    const T& operator*() const { return const_cast<Iterator*>(this)->operator*(); }
+
+    T* operator->() { return &this->operator*(); }
+
+    const T* operator->() const { return &this->operator*(); }
+
+public:
+    bool operator==(const Iterator& in) const { return self == in.self && index == in.index; }
+
+    bool operator!=(const Iterator& in) const { return !operator==(in); }
+
+private:
+    SwissBuffer* self;
+    size_t       index;
+};
+
+/**************************************************************************************************
+ * Group
+ **************************************************************************************************/
+
+template<typename T, typename A>
+auto SwissBuffer<T, A>::Group::match(const int8_t* in, int8_t tag) noexcept -> Mask {
+#ifdef LWE_SSE2
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    return Mask(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag))));
+#else
+    Mask out = 0;
+    for(size_t i = 0; i < SIZE; ++i) {
+        out |= Mask(in[i] == tag) << i;
+    }
+    return out;
+#endif
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::Group::empty(const int8_t* in) noexcept -> Mask {
+    return match(in, EMPTY);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::Group::vacant(const int8_t* in) noexcept -> Mask {
+#ifdef LWE_SSE2
+    // empty and deleted are negative: sign bit only
+    return Mask(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in))));
+#else
+    Mask out = 0;
+    for(size_t i = 0; i < SIZE; ++i) {
+        out |= Mask(in[i] < 0) << i;
+    }
+    return out;
+#endif
+}
+
+template<typename T, typename A> int SwissBuffer<T, A>::Group::first(Mask in) noexcept {
+#if COMPILER == MSVC
+    unsigned long out;
+    _BitScanForward(&out, in);
+    return int(out);
+#else
+    return __builtin_ctz(in);
+#endif
+}
+
+template<typename T, typename A> int SwissBuffer<T, A>::Group::last(Mask in) noexcept {
+#if COMPILER == MSVC
+    unsigned long out;
+    _BitScanReverse(&out, in);
+    return int(out);
+#else
+    return 31 - __builtin_clz(in);
+#endif
+}
+
+/**************************************************************************************************
+ * SwissBuffer
+ **************************************************************************************************/
+
+template<typename T, typename A> SwissBuffer<T, A>::SwissBuffer(float factor): LOAD_FACTOR(factor) { }
+
+template<typename T, typename A> SwissBuffer<T, A>::~SwissBuffer() {
+    if(slots) {
+        clear();
+        A::deallocate(slots);
+    }
+}
+
+template<typename T, typename A> SwissBuffer<T, A>::SwissBuffer(const SwissBuffer& in): LOAD_FACTOR(in.LOAD_FACTOR) {
+    if(in.counter == 0 || !rehash(in.capacitor)) {
+        return; // empty or bad alloc
+    }
+    for(size_t i = in.next(0); i < in.capacitor; i = in.next(i + 1)) {
+        emplace(in.slots[i].data, in.slots[i].hash); // copy
+    }
+}
+
+template<typename T, typename A>
+SwissBuffer<T, A>::SwissBuffer(SwissBuffer&& in) noexcept:
+    counter(in.counter),
+    capacitor(in.capacitor),
+    growth(in.growth),
+    log(in.log),
+    slots(in.slots),
+    ctrl(in.ctrl),
+    LOAD_FACTOR(in.LOAD_FACTOR) {
+    in.counter   = 0;
+    in.capacitor = 0;
+    in.growth    = 0;
+    in.log       = 0;
+    in.slots     = nullptr;
+    in.ctrl      = nullptr;
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::operator=(const SwissBuffer& in) -> SwissBuffer& {
+    if(this != &in) {
+        clear();
+        if(reserve(in.counter)) {
+            for(size_t i = in.next(0); i < in.capacitor; i = in.next(i + 1)) {
+                emplace(in.slots[i].data, in.slots[i].hash); // copy
+            }
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::operator=(SwissBuffer&& in) noexcept -> SwissBuffer& {
+    if(this != &in) {
+        if(slots) {
+            clear();
+            A::deallocate(slots);
+        }
+
+        // tombstones of source, growth is computed with its load factor
+        size_t deleted = in.capacitor ? in.limit(in.capacitor) - in.counter - in.growth : 0;
+
+        counter   = in.counter;
+        capacitor = in.capacitor;
+        log       = in.log;
+        slots     = in.slots;
+        ctrl      = in.ctrl;
+        growth    = 0;
+
+        in.counter   = 0;
+        in.capacitor = 0;
+        in.growth    = 0;
+        in.log       = 0;
+        in.slots     = nullptr;
+        in.ctrl      = nullptr;
+
+        // recalculate growth by own load factor, rehash when it would underflow
+        if(capacitor) {
+            if(limit(capacitor) >= counter + deleted) {
+                growth = limit(capacitor) - counter - deleted;
+            }
+            else {
+                size_t size = capacitor;
+                while(limit(size) < counter) {
+                    size <<= 1;
+                }
+                rehash(size); // false: growth 0, next insert retries
+            }
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::push(T&& in) {
+    return insert(std::move(in));
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::push(const T& in) {
+    return insert(in);
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::pop(const T& in) noexcept {
+    size_t index = probe(util::Hash<T>(in), [&in](const T& data) { return data == in; });
+    if(index == NONE) {
+        return false; // not found
+    }
+    remove(index);
+    return true;
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::exist(const T& in) const noexcept {
+    return probe(util::Hash<T>(in), [&in](const T& data) { return data == in; }) != NONE;
+}
+
+template<typename T, typename A>
+template<typename U> bool SwissBuffer<T, A>::insert(U&& in) {
+    hash_t hashed = util::Hash<T>(in);
+    // check
+    if(probe(hashed, [&in](const T& data) { return data == in; }) != NONE) {
+        return false;
+    }
+    return emplace(std::forward<U>(in), hashed);
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::erase(const Iterator<FWD>& in) noexcept {
+    if(in.self != this || in.index >= capacitor || ctrl[in.index] < 0) {
+        return false; // exception
+    }
+    remove(in.index);
+    return true;
+}
+
+template<typename T, typename A> size_t SwissBuffer<T, A>::size() const noexcept {
+    return counter;
+}
+
+template<typename T, typename A> size_t SwissBuffer<T, A>::capacity() const noexcept {
+    return capacitor;
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::reserve(size_t in) noexcept {
+    size_t size = core::align(in < Group::SIZE ? Group::SIZE : in);
+    while(limit(size) < in) {
+        size <<= 1;
+    }
+    if(size <= capacitor) {
+        return true; // already allocated
+    }
+    return rehash(size);
+}
+
+template<typename T, typename A>
+template<typename W> bool SwissBuffer<T, A>::build(T* in, size_t n, W*) {
+    if(!reserve(counter + n)) {
+        return false; // bad alloc
+    }
+    for(size_t i = 0; i < n; ++i) {
+        insert(std::move(in[i])); // false: exist
+    }
+    return true;
+}
+
+template<typename T, typename A> void SwissBuffer<T, A>::clear() noexcept {
+    if(capacitor == 0) {
+        return;
+    }
+
+    for(size_t i = next(0); i < capacitor; i = next(i + 1)) {
+        slots[i].data.~T();
+    }
+    std::memset(ctrl, EMPTY, capacitor + Group::SIZE - 1);
+
+    counter = 0;
+    growth  = limit(capacitor);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::find(const T& in) noexcept -> Iterator<FWD> {
+    size_t index = probe(util::Hash<T>(in), [&in](const T& data) { return data == in; });
+    if(index == NONE) {
+        return end(); // not found
+    }
+    return Iterator<FWD>(this, index);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::at(size_t index) noexcept -> Iterator<FWD> {
+    if(index >= counter) {
+        return end(); // out of range
+    }
+    size_t i = next(0);
+    for(; index != 0; --index) {
+        i = next(i + 1);
+    }
+    return Iterator<FWD>(this, i);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::begin() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, next(0));
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::end() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, capacitor);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::find(const T& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissBuffer*>(this)->find(in);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissBuffer*>(this)->at(in);
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissBuffer*>(this)->begin();
+}
+
+template<typename T, typename A> auto SwissBuffer<T, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissBuffer*>(this)->end();
+}
+
+template<typename T, typename A>
+template<typename F> size_t SwissBuffer<T, A>::probe(hash_t hashed, F&& fn) const noexcept {
+    if(capacitor == 0) {
+        return NONE;
+    }
+
+    size_t mask = capacitor - 1;
+    size_t pos  = home(hashed);
+    int8_t key  = tag(hashed);
+
+    // triangular, visits every group once
+    for(size_t step = 0; step <= capacitor; step += Group::SIZE) {
+        pos                 = (pos + step) & mask;
+        const int8_t* group = ctrl + pos;
+
+        // candidates
+        for(typename Group::Mask bits = Group::match(group, key); bits; bits &= bits - 1) {
+            size_t index = (pos + Group::first(bits)) & mask;
+            if(slots[index].hash == hashed && fn(slots[index].data)) {
+                return index;
+            }
+        }
+
+        // empty: end of probe sequence
+        if(Group::empty(group)) {
+            return NONE;
+        }
+    }
+    return NONE;
+}
+
+template<typename T, typename A> size_t SwissBuffer<T, A>::vacant(hash_t hashed) const noexcept {
+    size_t mask = capacitor - 1;
+    size_t pos  = home(hashed);
+
+    // growth keeps at least one empty, always found
+    for(size_t step = 0;; step += Group::SIZE) {
+        pos = (pos + step) & mask;
+        if(typename Group::Mask bits = Group::vacant(ctrl + pos)) {
+            return (pos + Group::first(bits)) & mask;
+        }
+    }
+}
+
+template<typename T, typename A> size_t SwissBuffer<T, A>::next(size_t in) const noexcept {
+    while(in < capacitor) {
+        typename Group::Mask bits = ~Group::vacant(ctrl + in) & 0xFFFF; // full
+
+        // clone bytes are not slots
+        if(capacitor - in < Group::SIZE) {
+            bits &= (typename Group::Mask(1) << (capacitor - in)) - 1;
+        }
+        if(bits) {
+            return in + Group::first(bits);
+        }
+        in += Group::SIZE;
+    }
+    return capacitor;
+}
+
+template<typename T, typename A>
+template<typename U> bool SwissBuffer<T, A>::emplace(U&& in, hash_t hashed) {
+    if(growth == 0) {
+        // tombstones take half: drop them, else grow
+        size_t size = capacitor == 0                      ? Group::SIZE :
+                      counter < (limit(capacitor) >> 1) ? capacitor :
+                                                          capacitor << 1;
+        if(!rehash(size)) {
+            return false; // bad alloc
+        }
+    }
+
+    size_t index = vacant(hashed);
+    bool   empty = ctrl[index] == EMPTY;
+
+    // copy or move, can throw
+    new(&slots[index].data) T(std::forward<U>(in));
+
+    slots[index].hash = hashed;
+    mark(index, tag(hashed));
+    ++counter;
+    if(empty) {
+        --growth; // tombstone reuse: no growth
+    }
+    return true;
+}
+
+template<typename T, typename A> void SwissBuffer<T, A>::remove(size_t index) {
+    slots[index].data.~T();
+    --counter;
+
+    // no probe sequence passed through a full group here: empty
+    size_t               mask   = capacitor - 1;
+    typename Group::Mask before = Group::empty(ctrl + ((index - Group::SIZE) & mask));
+    typename Group::Mask after  = Group::empty(ctrl + index);
+    if(before && after && (Group::first(after) + (Group::SIZE - 1 - Group::last(before))) < Group::SIZE) {
+        mark(index, EMPTY);
+        ++growth;
+    }
+    else mark(index, DELETED);
+}
+
+template<typename T, typename A> bool SwissBuffer<T, A>::rehash(size_t size) {
+    if(size < counter) {
+        return false; // shrink not allow
+    }
+
+    // slots and control bytes, one allocation
+    size_t bytes = sizeof(Slot) * size;
+    void*  newly = A::allocate(bytes + size + Group::SIZE - 1);
+    if(!newly) {
+        return false; // bad alloc
+    }
+
+    Slot*   oldslots = slots;
+    int8_t* oldctrl  = ctrl;
+    size_t  loop     = capacitor;
+
+    slots = static_cast<Slot*>(newly);
+    ctrl  = reinterpret_cast<int8_t*>(static_cast<uint8_t*>(newly) + bytes);
+    std::memset(ctrl, EMPTY, size + Group::SIZE - 1);
+
+    // update for fibonacci hash
+    log = 0;
+    while((size_t(1) << log) < size) {
+        ++log;
+    }
+    capacitor = size;
+    growth    = limit(size) - counter;
+
+    // move, hash is stored
+    if(oldslots) {
+        for(size_t i = 0; i < loop; ++i) {
+            if(oldctrl[i] < 0) {
+                continue; // empty or deleted
+            }
+            size_t index = vacant(oldslots[i].hash);
+            new(&slots[index].data) T(std::move(oldslots[i].data)); // move
+            slots[index].hash = oldslots[i].hash;                   // copy hash
+            mark(index, tag(oldslots[i].hash));
+            oldslots[i].data.~T(); // delete
+        }
+        A::deallocate(oldslots); // delete
+    }
+    return true;
+}
+
+template<typename T, typename A> void SwissBuffer<T, A>::mark(size_t index, int8_t in) noexcept {
+    ctrl[index] = in;
+    // index < 15: write clone after end, else write same byte again
+    ctrl[((index - (Group::SIZE - 1)) & (capacitor - 1)) + (Group::SIZE - 1)] = in;
+}
+
+template<typename T, typename A> size_t SwissBuffer<T, A>::home(hash_t in) const noexcept {
+    return size_t((in * 11'400'714'819'323'198'485ull) >> (64 - log));
+}
+
+template<typename T, typename A> int8_t SwissBuffer<T, A>::tag(hash_t in) const noexcept {
+    return int8_t(((in * 11'400'714'819'323'198'485ull) >> (64 - 7 - log)) & 0x7F); // bits under home
+}
+
+template<typename T, typename A> size_t SwissBuffer<T, A>::limit(size_t in) const noexcept {
+    float  factor = LOAD_FACTOR < 0.875f ? LOAD_FACTOR : 0.875f;
+    size_t out    = size_t(in * factor);
+    return out < in ? out : in - 1; // keep an empty
+}
+
+} // namespace container
+LWE_END
@@ -0,0 +1,190 @@
+LWE_BEGIN
+namespace container {
+
+template<typename K, typename V, typename A> SwissTable<K, V, A>::SwissTable(float factor): set(factor) { }
+
+template<typename K, typename V, typename A> V& SwissTable<K, V, A>::operator[](const K& in) {
+    hash_t hashed = util::Hash<K>(in);
+
+    size_t index = slot(hashed, in);
+    if(index == SwissBuffer::NONE) {
+        // insert and return
+        // empty data for call constructor
+        if(!set.emplace(Entry{ in, V{} }, hashed)) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+        index = slot(hashed, in);
+    }
+    return set.slots[index].data.second;
+}
+
+template<typename K, typename V, typename A> const V& SwissTable<K, V, A>::operator[](const K& in) const {
+    return const_cast<SwissTable*>(this)->operator[](in);
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::push(Entry&& in) {
+    return insert(std::move(in));
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::push(const Entry& in) {
+    return insert(in);
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::push(const K& k, const V& v) {
+    return insert(Entry{ k, v });
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::push(K&& k, V&& v) {
+    return insert(Entry{ std::move(k), std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::push(const K& k, V&& v) {
+    return insert(Entry{ k, std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::push(K&& k, const V& v) {
+    return insert(Entry{ std::move(k), v });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool SwissTable<K, V, A>::pop(const Q& in) {
+    return pop(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool SwissTable<K, V, A>::pop(const Q& in, hash_t hashed) {
+    size_t index = slot(hashed, in);
+
+    // not found
+    if(index == SwissBuffer::NONE) {
+        return false;
+    }
+    set.remove(index);
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool SwissTable<K, V, A>::exist(const Q& in) const noexcept {
+    return exist(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool SwissTable<K, V, A>::exist(const Q& in, hash_t hashed) const noexcept {
+    return slot(hashed, in) != SwissBuffer::NONE;
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::erase(const Iterator<FWD>& in) {
+    return set.erase(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool SwissTable<K, V, A>::insert(T&& in) {
+    return emplace(std::forward<T>(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool SwissTable<K, V, A>::insert(T&& k, U&& v) {
+    return emplace(Entry{ std::forward<T>(k), std::forward<U>(v) });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto SwissTable<K, V, A>::find(const Q& in) noexcept -> Iterator<FWD> {
+    return find(in, hashof(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto SwissTable<K, V, A>::find(const Q& in, hash_t hashed) noexcept -> Iterator<FWD> {
+    size_t index = slot(hashed, in);
+    if(index == SwissBuffer::NONE) {
+        return end(); // not found
+    }
+    return Iterator<FWD>(&set, index);
+}
+
+template<typename K, typename V, typename A> auto SwissTable<K, V, A>::at(size_t in) noexcept -> Iterator<FWD> {
+    return set.at(in);
+}
+
+template<typename K, typename V, typename A> auto SwissTable<K, V, A>::begin() noexcept -> Iterator<FWD> {
+    return set.begin();
+}
+
+template<typename K, typename V, typename A> auto SwissTable<K, V, A>::end() noexcept -> Iterator<FWD> {
+    return set.end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto SwissTable<K, V, A>::find(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissTable*>(this)->find(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto SwissTable<K, V, A>::find(const Q& in, hash_t hashed) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissTable*>(this)->find(in, hashed);
+}
+
+template<typename K, typename V, typename A>
+auto SwissTable<K, V, A>::at(size_t in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissTable*>(this)->at(in);
+}
+
+template<typename K, typename V, typename A>
+auto SwissTable<K, V, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissTable*>(this)->begin();
+}
+
+template<typename K, typename V, typename A>
+auto SwissTable<K, V, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<SwissTable*>(this)->end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> hash_t SwissTable<K, V, A>::hashof(const Q& in) {
+    return util::Hash<K>(in);
+}
+
+template<typename K, typename V, typename A> size_t SwissTable<K, V, A>::size() const noexcept {
+    return set.counter;
+}
+
+template<typename K, typename V, typename A> size_t SwissTable<K, V, A>::capacity() const noexcept {
+    return set.capacitor;
+}
+
+template<typename K, typename V, typename A> bool SwissTable<K, V, A>::reserve(size_t in) noexcept {
+    return set.reserve(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename W> bool SwissTable<K, V, A>::build(Entry* in, size_t n, W*) {
+    if(!reserve(size() + n)) {
+        return false; // bad alloc
+    }
+    for(size_t i = 0; i < n; ++i) {
+        insert(std::move(in[i])); // false: exist
+    }
+    return true;
+}
+
+template<typename K, typename V, typename A> void SwissTable<K, V, A>::clear() noexcept {
+    set.clear();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> size_t SwissTable<K, V, A>::slot(hash_t in, const Q& key) const noexcept {
+    return set.probe(in, [&key](const Entry& data) { return data.first == key; }); // key only
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool SwissTable<K, V, A>::emplace(T&& in) {
+    hash_t hashed = util::Hash<K>(in.first); // first only
+
+    // check collide
+    if(slot(hashed, in.first) != SwissBuffer::NONE) {
+        return false;
+    }
+    return set.emplace(std::forward<T>(in), hashed);
+}
+
+} // namespace container
+LWE_END
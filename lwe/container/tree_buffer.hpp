@@ -0,0 +1,190 @@
+/**************************************************************************************************
+ * B+TREE SET (ordered, wide nodes)
+ *
+ * node
+ * - size  : config::TREENODE bytes (default 256, 4 cache lines)
+ * - source: Pooled (default) -> mem::Allocator<Node, 64>, pooled and cache line aligned
+ *           allocator policy -> node bytes from A, e.g. mem::Heap, mem::Frame (see mem/system.hpp)
+ *
+ * memory layout
+ *                       inner [ k0 | k1 ]                  < keys + children, no data
+ *                     /         |        \
+ *   leaf [ a | b | c ] <-> [ k0 | d | e ] <-> [ k1 | f ]   < data in order, linked both ways
+ *
+ *   separator: data of child[i] < key[i] <= data of child[i + 1]
+ *
+ * - search : binary search per node, node lines are prefetched on descent
+ * - iterate: leaf chain, data is contiguous in a leaf
+ * - range  : one descent to the lower bound, then leaf scan
+ * - split  : half and half, append to the last leaf moves only the new data (sorted load is full)
+ * - erase  : borrow from a sibling or merge with it, root shrinks when it has one child
+ *
+ * e.g. int set, 256 bytes node
+ *  - leaf : 58 data
+ *  - inner: 20 keys, 21 children
+ *
+ * NOTE: K is the key of T, T itself for a set (see TreeTable for a map).
+ * NOTE: keys are compared by operator<, Q of lookup needs Q < K and K < Q.
+ * NOTE: insert and erase invalidate iterators of the changed leaves.
+ * NOTE: relocatable T and K (core::Relocatable) shift and split by memmove / memcpy.
+ **************************************************************************************************/
+
+#ifndef LWE_CONTAINER_TREE_BUFFER
+#define LWE_CONTAINER_TREE_BUFFER
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../mem/allocator.hpp"
+#include "iterator.hpp"
+
+LWE_BEGIN
+namespace container {
+
+//! @brief default node source of TreeBuffer and TreeTable, a typed pool for each node type
+struct Pooled { };
+
+//! @tparam K key type, T for a set
+//! @tparam A Pooled or allocator policy, see mem/system.hpp
+template<typename T, typename K = T, typename A = Pooled> class TreeBuffer {
+public:
+    template<typename, typename, typename> friend class TreeTable; //!< for composition
+
+public:
+    CONTAINER_BODY(TreeBuffer, T, T, K, A);
+    using Allocator = A;
+
+private:
+    static constexpr size_t LINE  = 64; //!< cache line
+    static constexpr size_t DEPTH = 64; //!< max depth, fanout is 2 or more
+
+private:
+    struct Node {
+        uint32_t count; // data (leaf) or key (inner) count
+        bool     leaf;  // node type
+    };
+
+    //! @brief node capacity, 4 or more for split and merge
+    static constexpr size_t fit(size_t in) noexcept { return in < 4 ? 4 : in; }
+
+public:
+    static constexpr size_t LEAF  = fit((config::TREENODE - sizeof(Node) - 2 * sizeof(void*)) / sizeof(T));
+    static constexpr size_t INNER = fit((config::TREENODE - sizeof(Node) - sizeof(void*)) / (sizeof(K) + sizeof(void*)));
+
+private:
+    struct Leaf: Node {
+        Leaf() noexcept: Node{ 0, true } { }
+        T* data() noexcept { return reinterpret_cast<T*>(raw); }
+
+        Leaf* prev = nullptr;                // previous leaf
+        Leaf* next = nullptr;                // next leaf
+        alignas(T) uint8_t raw[sizeof(T) * LEAF]; // data storage
+    };
+
+    struct Inner: Node {
+        Inner() noexcept: Node{ 0, false } { }
+        K* keys() noexcept { return reinterpret_cast<K*>(raw); }
+
+        Node* child[INNER + 1];              // children, count + 1
+        alignas(K) uint8_t raw[sizeof(K) * INNER]; // key storage
+    };
+
+    //! @brief descent record, inner node and child index per depth
+    struct Path {
+        Inner* node[DEPTH];
+        size_t slot[DEPTH];
+        size_t depth = 0;
+    };
+
+    //! @brief node source, mem::Allocator for Pooled, else node bytes from A
+    template<typename N> struct Source {
+        static N*     allocate() noexcept;           //!< nullptr: bad alloc
+        static size_t allocate(size_t, N**) noexcept; //!< batch @return allocated count
+        static void   deallocate(N*) noexcept;        //!< free
+    };
+
+    using Leaves = Source<Leaf>;
+    using Inners = Source<Inner>;
+
+public:
+    TreeBuffer() noexcept = default;
+
+public:
+    ~TreeBuffer();                                //!< free
+    TreeBuffer(const TreeBuffer&);                //!< deep copy
+    TreeBuffer(TreeBuffer&&) noexcept;            //!< move
+    TreeBuffer& operator=(const TreeBuffer&);     //!< deep copy
+    TreeBuffer& operator=(TreeBuffer&&) noexcept; //!< move
+
+public:
+    bool push(T&&);                      //!< insert in order
+    bool push(const T&);                 //!< insert in order
+    bool pop(const T&) noexcept;         //!< pop
+    bool exist(const T&) const noexcept; //!< check data
+
+public:
+    template<typename U> bool insert(U&&);                          //!< insert
+    bool                      erase(const Iterator<FWD>&) noexcept; //!< iterator erase
+
+public:
+    size_t size() const noexcept; //!< element count
+    void   clear() noexcept;      //!< free all nodes
+
+public:
+    //! @brief visit data in [from, to) in order, F: void(const T&)
+    //! @return visited count
+    template<typename Q, typename F> size_t scan(const Q&, const Q&, F&&) const;
+
+public:
+    template<typename Q = K> Iterator<FWD> find(const Q&) noexcept;        //!< find by key
+    template<typename Q = K> Iterator<FWD> lower_bound(const Q&) noexcept; //!< first not less than key
+    template<typename Q = K> Iterator<FWD> upper_bound(const Q&) noexcept; //!< first greater than key
+    Iterator<FWD>                          begin() noexcept;               //!< get begin, smallest
+    Iterator<FWD>                          end() noexcept;                 //!< get end
+
+public:
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&) const noexcept;        //!< find by key const
+    template<typename Q = K> Iterator<FWD | VIEW> lower_bound(const Q&) const noexcept; //!< first not less than key const
+    template<typename Q = K> Iterator<FWD | VIEW> upper_bound(const Q&) const noexcept; //!< first greater than key const
+    Iterator<FWD | VIEW>                          begin() const noexcept;               //!< get begin const
+    Iterator<FWD | VIEW>                          end() const noexcept;                 //!< get end const
+
+private:
+    static const K& keyof(const T&) noexcept; //!< key of data
+
+private:
+    template<typename Q> Leaf*         descend(const Q&, Path*) const noexcept; //!< leaf of key, path recorded
+    template<typename Q> static size_t search(Leaf*, const Q&) noexcept;        //!< first data not less than key
+    template<typename Q> static size_t route(Inner*, const Q&) noexcept;        //!< child index of key
+    template<typename Q> Iterator<FWD> bound(const Q&, bool) noexcept;          //!< lower or upper bound
+
+private:
+    template<typename U> T* emplace(U&&, bool*); //!< insert detail, existing or new data, nullptr: bad alloc
+    void                    remove(Path&, Leaf*, size_t) noexcept; //!< erase detail, rebalance to root
+
+private:
+    void split(Path&, K&&, Node*, Inner**, bool) noexcept; //!< push key and right node to parents
+    void balance(Inner*, size_t) noexcept;                 //!< fix underflow child
+    void merge(Inner*, size_t) noexcept;                   //!< child[i + 1] into child[i]
+    void release(Node*) noexcept;                          //!< free subtree
+
+private:
+    template<typename U> static void open(U*, size_t, size_t) noexcept;     //!< raw hole at index, shift right
+    template<typename U> static void close(U*, size_t, size_t) noexcept;    //!< destroy at index, shift left
+    template<typename U> static void transfer(U*, U*, size_t) noexcept;     //!< move construct and destroy source
+    template<typename U> static void destroy(U*, size_t) noexcept;          //!< destroy n
+    static void                      prefetch(const Node*) noexcept;        //!< all lines of node
+
+private:
+    Node*  root    = nullptr; //!< leaf or inner
+    Leaf*  head    = nullptr; //!< first leaf
+    Leaf*  tail    = nullptr; //!< last leaf
+    size_t counter = 0;       //!< element count
+};
+
+//! @brief set of TreeBuffer, data is the key
+template<typename T, typename A = Pooled> using TreeSet = TreeBuffer<T, T, A>;
+
+} // namespace container
+LWE_END
+#include "tree_buffer.ipp"
+#endif
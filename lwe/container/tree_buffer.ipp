@@ -0,0 +1,701 @@
+LWE_BEGIN
+namespace container {
+/**************************************************************************************************
+ * Iterator
+ **************************************************************************************************/
+REGISTER_CONST_ITERATOR((typename T, typename K, typename A), FWD, TreeBuffer, T, K, A);
+
+template<typename T, typename K, typename A> class Iterator<FWD, TreeBuffer<T, K, A>> {
+    ITERATOR_BODY(FWD, TreeBuffer, T, K, A);
+    using Leaf = typename TreeBuffer::Leaf;
+    friend TreeBuffer; //!< erase
+
+public:
+    Iterator(TreeBuffer* self, Leaf* leaf, size_t index): self(self), leaf(leaf), index(index) { }
+
+public:
+    Iterator& operator++() {
+        if(leaf && ++index == leaf->count) {
+            leaf  = leaf->next; // nullptr: end
+            index = 0;
+        }
+        return *this;
+    }
+
+    Iterator& operator--() {
+        if(leaf == nullptr) {
+            leaf  = self->tail; // end -> last
+            index = leaf ? leaf->count - 1 : 0;
+        }
+        else if(index != 0) {
+            --index;
+        }
+        else if(leaf->prev) {
+            leaf  = leaf->prev;
+            index = leaf->count - 1;
+        }
+        return *this;
+    }
+
+public:
+    T& operator*() { return leaf->data()[index]; }
+
+    const T& operator*() const { return const_cast<Iterator*>(this)->operator*(); }
+
+    T* operator->() { return &this->operator*(); }
+
+    const T* operator->() const { return &this->operator*(); }
+
+public:
+    bool operator==(const Iterator& in) const { return leaf == in.leaf && index == in.index; }
+
+    bool operator!=(const Iterator& in) const { return !operator==(in); }
+
+private:
+    TreeBuffer* self;
+    Leaf*       leaf;  // nullptr: end
+    size_t      index; // position in leaf
+};
+
+/**************************************************************************************************
+ * TreeBuffer
+ **************************************************************************************************/
+
+template<typename T, typename K, typename A> TreeBuffer<T, K, A>::~TreeBuffer() {
+    clear();
+}
+
+template<typename T, typename K, typename A> TreeBuffer<T, K, A>::TreeBuffer(const TreeBuffer& in) {
+    for(const T& it : in) {
+        push(it); // sorted, append split keeps leaves full
+    }
+}
+
+template<typename T, typename K, typename A>
+TreeBuffer<T, K, A>::TreeBuffer(TreeBuffer&& in) noexcept:
+    root(in.root),
+    head(in.head),
+    tail(in.tail),
+    counter(in.counter) {
+    in.root    = nullptr;
+    in.head    = nullptr;
+    in.tail    = nullptr;
+    in.counter = 0;
+}
+
+template<typename T, typename K, typename A> auto TreeBuffer<T, K, A>::operator=(const TreeBuffer& in) -> TreeBuffer& {
+    if(this != &in) {
+        clear();
+        for(const T& it : in) {
+            push(it);
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename K, typename A> auto TreeBuffer<T, K, A>::operator=(TreeBuffer&& in) noexcept -> TreeBuffer& {
+    if(this != &in) {
+        clear();
+        root    = in.root;
+        head    = in.head;
+        tail    = in.tail;
+        counter = in.counter;
+
+        in.root    = nullptr;
+        in.head    = nullptr;
+        in.tail    = nullptr;
+        in.counter = 0;
+    }
+    return *this;
+}
+
+template<typename T, typename K, typename A> bool TreeBuffer<T, K, A>::push(T&& in) {
+    return insert(std::move(in));
+}
+
+template<typename T, typename K, typename A> bool TreeBuffer<T, K, A>::push(const T& in) {
+    return insert(in);
+}
+
+template<typename T, typename K, typename A> bool TreeBuffer<T, K, A>::pop(const T& in) noexcept {
+    if(root == nullptr) {
+        return false; // empty
+    }
+
+    Path   path;
+    Leaf*  leaf = descend(keyof(in), &path);
+    size_t pos  = search(leaf, keyof(in));
+    if(pos == leaf->count || keyof(in) < keyof(leaf->data()[pos])) {
+        return false; // not found
+    }
+    remove(path, leaf, pos);
+    return true;
+}
+
+template<typename T, typename K, typename A> bool TreeBuffer<T, K, A>::exist(const T& in) const noexcept {
+    return find(keyof(in)) != end();
+}
+
+template<typename T, typename K, typename A>
+template<typename U> bool TreeBuffer<T, K, A>::insert(U&& in) {
+    bool created = false;
+    if(emplace(std::forward<U>(in), &created) == nullptr) {
+        return false; // bad alloc
+    }
+    return created;
+}
+
+template<typename T, typename K, typename A> bool TreeBuffer<T, K, A>::erase(const Iterator<FWD>& in) noexcept {
+    if(in.self != this || in.leaf == nullptr) {
+        return false; // exception
+    }
+
+    // descent again for path, same leaf
+    Path path;
+    descend(keyof(in.leaf->data()[in.index]), &path);
+    remove(path, in.leaf, in.index);
+    return true;
+}
+
+template<typename T, typename K, typename A> size_t TreeBuffer<T, K, A>::size() const noexcept {
+    return counter;
+}
+
+template<typename T, typename K, typename A> void TreeBuffer<T, K, A>::clear() noexcept {
+    if(root) {
+        release(root);
+    }
+    root    = nullptr;
+    head    = nullptr;
+    tail    = nullptr;
+    counter = 0;
+}
+
+template<typename T, typename K, typename A>
+template<typename Q, typename F> size_t TreeBuffer<T, K, A>::scan(const Q& from, const Q& to, F&& fn) const {
+    if(root == nullptr) {
+        return 0;
+    }
+
+    Leaf*  leaf = descend(from, nullptr);
+    size_t pos  = search(leaf, from);
+    size_t cnt  = 0;
+
+    // leaf by leaf, no iterator
+    for(; leaf; leaf = leaf->next, pos = 0) {
+        const T* data = leaf->data();
+        for(; pos < leaf->count; ++pos) {
+            if(!(keyof(data[pos]) < to)) {
+                return cnt; // reached end of range
+            }
+            fn(data[pos]);
+            ++cnt;
+        }
+    }
+    return cnt;
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::find(const Q& in) noexcept -> Iterator<FWD> {
+    Iterator<FWD> it = bound(in, false);
+    if(it.leaf == nullptr || in < keyof(*it)) {
+        return end(); // not found
+    }
+    return it;
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::lower_bound(const Q& in) noexcept -> Iterator<FWD> {
+    return bound(in, false);
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::upper_bound(const Q& in) noexcept -> Iterator<FWD> {
+    return bound(in, true);
+}
+
+template<typename T, typename K, typename A> auto TreeBuffer<T, K, A>::begin() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, head, 0);
+}
+
+template<typename T, typename K, typename A> auto TreeBuffer<T, K, A>::end() noexcept -> Iterator<FWD> {
+    return Iterator<FWD>(this, nullptr, 0);
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::find(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeBuffer*>(this)->find(in);
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::lower_bound(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeBuffer*>(this)->lower_bound(in);
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::upper_bound(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeBuffer*>(this)->upper_bound(in);
+}
+
+template<typename T, typename K, typename A> auto TreeBuffer<T, K, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeBuffer*>(this)->begin();
+}
+
+template<typename T, typename K, typename A> auto TreeBuffer<T, K, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeBuffer*>(this)->end();
+}
+
+template<typename T, typename K, typename A> const K& TreeBuffer<T, K, A>::keyof(const T& in) noexcept {
+    if constexpr(std::is_same_v<T, K>) {
+        return in;
+    }
+    else return in.first; // entry of table
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::descend(const Q& key, Path* path) const noexcept -> Leaf* {
+    Node* node = root;
+    while(!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        size_t slot  = route(inner, key);
+        if(path) {
+            path->node[path->depth] = inner;
+            path->slot[path->depth] = slot;
+            ++path->depth;
+        }
+        node = inner->child[slot];
+        prefetch(node); // whole node, binary search touches lines out of order
+    }
+    return static_cast<Leaf*>(node);
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> size_t TreeBuffer<T, K, A>::search(Leaf* in, const Q& key) noexcept {
+    const T* data = in->data();
+    size_t   lo   = 0;
+    size_t   hi   = in->count;
+    while(lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        if(keyof(data[mid]) < key) {
+            lo = mid + 1;
+        }
+        else hi = mid;
+    }
+    return lo;
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> size_t TreeBuffer<T, K, A>::route(Inner* in, const Q& key) noexcept {
+    const K* keys = in->keys();
+    size_t   lo   = 0;
+    size_t   hi   = in->count;
+    while(lo < hi) {
+        size_t mid = (lo + hi) >> 1;
+        if(key < keys[mid]) {
+            hi = mid;
+        }
+        else lo = mid + 1; // equal goes right, see separator
+    }
+    return lo;
+}
+
+template<typename T, typename K, typename A>
+template<typename Q> auto TreeBuffer<T, K, A>::bound(const Q& in, bool upper) noexcept -> Iterator<FWD> {
+    if(root == nullptr) {
+        return end(); // empty
+    }
+
+    Leaf*  leaf = descend(in, nullptr);
+    size_t pos  = search(leaf, in);
+    if(upper) {
+        while(pos < leaf->count && !(in < keyof(leaf->data()[pos]))) {
+            ++pos; // unique keys, at most one step
+        }
+    }
+
+    // out of leaf: first of next leaf
+    if(pos == leaf->count) {
+        return Iterator<FWD>(this, leaf->next, 0);
+    }
+    return Iterator<FWD>(this, leaf, pos);
+}
+
+template<typename T, typename K, typename A>
+template<typename U> T* TreeBuffer<T, K, A>::emplace(U&& in, bool* created) {
+    if(root == nullptr) {
+        Leaf* leaf = Leaves::allocate();
+        if(leaf == nullptr) {
+            return nullptr; // bad alloc
+        }
+        root = head = tail = leaf;
+    }
+
+    Path   path;
+    Leaf*  leaf = descend(keyof(in), &path);
+    size_t pos  = search(leaf, keyof(in));
+    if(pos < leaf->count && !(keyof(in) < keyof(leaf->data()[pos]))) {
+        *created = false;
+        return &leaf->data()[pos]; // exist
+    }
+
+    // room: in place, construct first, open and move do not throw
+    if(leaf->count < LEAF) {
+        T data(std::forward<U>(in));
+        open(leaf->data(), leaf->count, pos);
+        new(leaf->data() + pos) T(std::move(data));
+        ++leaf->count;
+        ++counter;
+        *created = true;
+        return leaf->data() + pos;
+    }
+
+    // nodes for split: leaf, full parents, new root
+    Inner* spare[DEPTH + 1];
+    size_t need = 0;
+    while(need < path.depth && path.node[path.depth - 1 - need]->count == INNER) {
+        ++need;
+    }
+    need += need == path.depth; // root splits too
+
+    Leaf*  right = Leaves::allocate();
+    size_t got   = right ? Inners::allocate(need, spare) : 0;
+    if(right == nullptr || got != need) {
+        for(size_t i = 0; i < got; ++i) {
+            Inners::deallocate(spare[i]); // partial
+        }
+        if(right) {
+            Leaves::deallocate(right);
+        }
+        return nullptr; // bad alloc
+    }
+
+    // construct first, moves below do not throw
+    T data(std::forward<U>(in));
+
+    // append to the last leaf: move nothing, sorted load keeps leaves full
+    size_t count  = leaf->count;
+    bool   append = leaf == tail && pos == count;
+    size_t mid    = append ? count : (count + 1) >> 1;
+
+    transfer(right->data(), leaf->data() + mid, count - mid);
+    right->count = uint32_t(count - mid);
+    leaf->count  = uint32_t(mid);
+
+    // link
+    right->prev = leaf;
+    right->next = leaf->next;
+    if(leaf->next) {
+        leaf->next->prev = right;
+    }
+    else tail = right;
+    leaf->next = right;
+
+    // put to the half
+    Leaf* target = pos <= mid && !append ? leaf : right;
+    pos          = target == leaf ? pos : pos - mid;
+    open(target->data(), target->count, pos);
+    new(target->data() + pos) T(std::move(data));
+    ++target->count;
+    ++counter;
+
+    split(path, K(keyof(right->data()[0])), right, spare, append);
+    *created = true;
+    return target->data() + pos;
+}
+
+template<typename T, typename K, typename A> void TreeBuffer<T, K, A>::remove(Path& path, Leaf* leaf, size_t pos) noexcept {
+    close(leaf->data(), leaf->count, pos);
+    --leaf->count;
+    --counter;
+
+    // underflow: fix from bottom, merge can underflow the parent
+    Node* node = leaf;
+    while(path.depth != 0) {
+        size_t min = node->leaf ? (LEAF >> 1) : (INNER >> 1);
+        if(node->count >= min) {
+            return; // enough
+        }
+        --path.depth;
+        Inner* parent = path.node[path.depth];
+        size_t before = parent->count;
+        balance(parent, path.slot[path.depth]);
+        if(parent->count == before) {
+            return; // borrowed, parent unchanged
+        }
+        node = parent;
+    }
+
+    // root shrink
+    if(root->count == 0) {
+        if(root->leaf) {
+            Leaves::deallocate(static_cast<Leaf*>(root));
+            root = head = tail = nullptr;
+        }
+        else {
+            Inner* old = static_cast<Inner*>(root);
+            root       = old->child[0];
+            Inners::deallocate(old);
+        }
+    }
+}
+
+template<typename T, typename K, typename A>
+void TreeBuffer<T, K, A>::split(Path& path, K&& key, Node* node, Inner** spare, bool append) noexcept {
+    K up(std::move(key)); // key to push, node is its right child
+
+    while(path.depth != 0) {
+        --path.depth;
+        Inner* inner = path.node[path.depth];
+        size_t slot  = path.slot[path.depth]; // key index, child index - 1
+
+        // room: in place
+        if(inner->count < INNER) {
+            open(inner->keys(), inner->count, slot);
+            new(inner->keys() + slot) K(std::move(up));
+            std::memmove(inner->child + slot + 2, inner->child + slot + 1, (inner->count - slot) * sizeof(Node*));
+            inner->child[slot + 1] = node;
+            ++inner->count;
+            return;
+        }
+
+        // split at half: keys [0, half) stay, key[half] goes up, (half, count) move right
+        // append: one key and two children move right, left stays full
+        Inner* right = *spare++;
+        size_t count = inner->count;
+        size_t half  = append ? count - 1 : count >> 1;
+
+        transfer(right->keys(), inner->keys() + half + 1, count - half - 1);
+        std::memcpy(right->child, inner->child + half + 1, (count - half) * sizeof(Node*));
+        right->count = uint32_t(count - half - 1);
+
+        K mid(std::move(inner->keys()[half]));
+        destroy(inner->keys() + half, 1);
+        inner->count = uint32_t(half);
+
+        // put to the half, slot <= half: left end or before
+        Inner* target = slot <= half ? inner : right;
+        slot          = target == inner ? slot : slot - half - 1;
+        open(target->keys(), target->count, slot);
+        new(target->keys() + slot) K(std::move(up));
+        std::memmove(target->child + slot + 2, target->child + slot + 1, (target->count - slot) * sizeof(Node*));
+        target->child[slot + 1] = node;
+        ++target->count;
+
+        up   = std::move(mid);
+        node = right;
+    }
+
+    // root split: new root of two
+    Inner* top    = *spare;
+    top->count    = 1;
+    top->child[0] = root;
+    top->child[1] = node;
+    new(top->keys()) K(std::move(up));
+    root = top;
+}
+
+template<typename T, typename K, typename A> void TreeBuffer<T, K, A>::balance(Inner* parent, size_t i) noexcept {
+    Node*  node = parent->child[i];
+    size_t min  = node->leaf ? (LEAF >> 1) : (INNER >> 1);
+
+    // borrow from left
+    if(i > 0 && parent->child[i - 1]->count > min) {
+        if(node->leaf) {
+            Leaf* left = static_cast<Leaf*>(parent->child[i - 1]);
+            Leaf* self = static_cast<Leaf*>(node);
+            open(self->data(), self->count, 0);
+            new(self->data()) T(std::move(left->data()[left->count - 1]));
+            destroy(left->data() + left->count - 1, 1);
+            --left->count;
+            ++self->count;
+            parent->keys()[i - 1] = keyof(self->data()[0]);
+        }
+        else {
+            Inner* left = static_cast<Inner*>(parent->child[i - 1]);
+            Inner* self = static_cast<Inner*>(node);
+            open(self->keys(), self->count, 0);
+            new(self->keys()) K(std::move(parent->keys()[i - 1]));
+            std::memmove(self->child + 1, self->child, (self->count + 1) * sizeof(Node*));
+            self->child[0]        = left->child[left->count];
+            parent->keys()[i - 1] = std::move(left->keys()[left->count - 1]);
+            destroy(left->keys() + left->count - 1, 1);
+            --left->count;
+            ++self->count;
+        }
+        return;
+    }
+
+    // borrow from right
+    if(i < parent->count && parent->child[i + 1]->count > min) {
+        if(node->leaf) {
+            Leaf* right = static_cast<Leaf*>(parent->child[i + 1]);
+            Leaf* self  = static_cast<Leaf*>(node);
+            new(self->data() + self->count) T(std::move(right->data()[0]));
+            close(right->data(), right->count, 0);
+            --right->count;
+            ++self->count;
+            parent->keys()[i] = keyof(right->data()[0]);
+        }
+        else {
+            Inner* right = static_cast<Inner*>(parent->child[i + 1]);
+            Inner* self  = static_cast<Inner*>(node);
+            new(self->keys() + self->count) K(std::move(parent->keys()[i]));
+            self->child[self->count + 1] = right->child[0];
+            parent->keys()[i]            = std::move(right->keys()[0]);
+            close(right->keys(), right->count, 0);
+            std::memmove(right->child, right->child + 1, right->count * sizeof(Node*));
+            --right->count;
+            ++self->count;
+        }
+        return;
+    }
+
+    // merge with a sibling, both are small
+    merge(parent, i > 0 ? i - 1 : i);
+}
+
+template<typename T, typename K, typename A> void TreeBuffer<T, K, A>::merge(Inner* parent, size_t i) noexcept {
+    Node* left  = parent->child[i];
+    Node* right = parent->child[i + 1];
+
+    if(left->leaf) {
+        Leaf* l = static_cast<Leaf*>(left);
+        Leaf* r = static_cast<Leaf*>(right);
+        transfer(l->data() + l->count, r->data(), r->count);
+        l->count += r->count;
+
+        // unlink
+        l->next = r->next;
+        if(r->next) {
+            r->next->prev = l;
+        }
+        else tail = l;
+        Leaves::deallocate(r);
+    }
+    else {
+        Inner* l = static_cast<Inner*>(left);
+        Inner* r = static_cast<Inner*>(right);
+        new(l->keys() + l->count) K(std::move(parent->keys()[i])); // separator comes down
+        transfer(l->keys() + l->count + 1, r->keys(), r->count);
+        std::memcpy(l->child + l->count + 1, r->child, (r->count + 1) * sizeof(Node*));
+        l->count += r->count + 1;
+        Inners::deallocate(r);
+    }
+
+    // drop separator and right child
+    close(parent->keys(), parent->count, i);
+    std::memmove(parent->child + i + 1, parent->child + i + 2, (parent->count - i - 1) * sizeof(Node*));
+    --parent->count;
+}
+
+template<typename T, typename K, typename A> void TreeBuffer<T, K, A>::release(Node* in) noexcept {
+    if(in->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(in);
+        destroy(leaf->data(), leaf->count);
+        Leaves::deallocate(leaf);
+        return;
+    }
+
+    Inner* inner = static_cast<Inner*>(in);
+    for(size_t i = 0; i <= inner->count; ++i) {
+        release(inner->child[i]); // depth is small
+    }
+    destroy(inner->keys(), inner->count);
+    Inners::deallocate(inner);
+}
+
+template<typename T, typename K, typename A>
+template<typename N> N* TreeBuffer<T, K, A>::Source<N>::allocate() noexcept {
+    if constexpr(std::is_same_v<A, Pooled>) {
+        return mem::Allocator<N, LINE>::allocate();
+    }
+    else {
+        void* ptr = A::allocate(sizeof(N));
+        return ptr ? new(ptr) N() : nullptr;
+    }
+}
+
+template<typename T, typename K, typename A>
+template<typename N> size_t TreeBuffer<T, K, A>::Source<N>::allocate(size_t size, N** out) noexcept {
+    if constexpr(std::is_same_v<A, Pooled>) {
+        return mem::Allocator<N, LINE>::allocate(size, out);
+    }
+    else {
+        size_t cnt = 0;
+        while(cnt < size && (out[cnt] = allocate()) != nullptr) {
+            ++cnt;
+        }
+        return cnt;
+    }
+}
+
+template<typename T, typename K, typename A>
+template<typename N> void TreeBuffer<T, K, A>::Source<N>::deallocate(N* in) noexcept {
+    if constexpr(std::is_same_v<A, Pooled>) {
+        mem::Allocator<N, LINE>::deallocate(in);
+    }
+    else if(in) {
+        in->~N();
+        A::deallocate(in);
+    }
+}
+
+template<typename T, typename K, typename A>
+template<typename U> void TreeBuffer<T, K, A>::open(U* in, size_t count, size_t index) noexcept {
+    if constexpr(Relocatable<U>::value) {
+        std::memmove(in + index + 1, in + index, (count - index) * sizeof(U));
+    }
+    else if(index < count) {
+        new(in + count) U(std::move(in[count - 1]));
+        for(size_t i = count - 1; i > index; --i) {
+            in[i] = std::move(in[i - 1]);
+        }
+        in[index].~U(); // raw
+    }
+}
+
+template<typename T, typename K, typename A>
+template<typename U> void TreeBuffer<T, K, A>::close(U* in, size_t count, size_t index) noexcept {
+    if constexpr(Relocatable<U>::value) {
+        in[index].~U();
+        std::memmove(in + index, in + index + 1, (count - index - 1) * sizeof(U));
+    }
+    else {
+        for(size_t i = index; i + 1 < count; ++i) {
+            in[i] = std::move(in[i + 1]);
+        }
+        in[count - 1].~U();
+    }
+}
+
+template<typename T, typename K, typename A>
+template<typename U> void TreeBuffer<T, K, A>::transfer(U* out, U* in, size_t count) noexcept {
+    if constexpr(Relocatable<U>::value) {
+        std::memcpy(out, in, count * sizeof(U));
+    }
+    else {
+        for(size_t i = 0; i < count; ++i) {
+            new(out + i) U(std::move(in[i]));
+            in[i].~U();
+        }
+    }
+}
+
+template<typename T, typename K, typename A>
+template<typename U> void TreeBuffer<T, K, A>::destroy(U* in, size_t count) noexcept {
+    if constexpr(!std::is_trivially_destructible_v<U>) {
+        for(size_t i = 0; i < count; ++i) {
+            in[i].~U();
+        }
+    }
+}
+
+template<typename T, typename K, typename A> void TreeBuffer<T, K, A>::prefetch(const Node* in) noexcept {
+    const char* ptr = reinterpret_cast<const char*>(in);
+    for(size_t i = 0; i < config::TREENODE; i += LINE) {
+        core::prefetch(ptr + i);
+    }
+}
+
+} // namespace container
+LWE_END
@@ -0,0 +1,80 @@
+#ifndef LWE_CONTAINER_TREE_TABLE
+#define LWE_CONTAINER_TREE_TABLE
+
+#include "../config/config.h"
+#include "iterator.hpp"
+#include "hash_table.hpp"
+#include "tree_buffer.hpp"
+
+LWE_BEGIN
+namespace container {
+
+//! @brief ordered map on TreeBuffer, entries sorted by key
+//! @tparam A Pooled or allocator policy, see mem/system.hpp
+template<typename K, typename V, typename A = Pooled> class TreeTable {
+public:
+    using Entry     = Record<K, V>;
+    using Allocator = A;
+public:
+    CONTAINER_BODY(TreeBuffer, Entry, Entry, K, A);
+private:
+    using TreeBuffer = TreeBuffer<Entry, K, A>;
+    using Leaf       = typename TreeBuffer::Leaf;
+    using Path       = typename TreeBuffer::Path;
+
+public:
+    V&       operator[](const K&);
+    const V& operator[](const K& in) const;
+
+public:
+    bool push(Entry&&);
+    bool push(const Entry&);
+    bool push(const K&, const V&);
+    bool push(K&&, V&&);
+    bool push(const K&, V&&);
+    bool push(K&&, const V&);
+
+public:
+    //! @note Q: K or any type ordered with K by operator< both ways (e.g. StringView for String)
+    template<typename Q = K> bool pop(const Q&) noexcept;         //!< pop
+    template<typename Q = K> bool exist(const Q&) const noexcept; //!< check key
+
+public:
+    template<typename T> bool             insert(T&&);
+    template<typename T, typename U> bool insert(T&&, U&&);
+    bool                                  erase(const Iterator<FWD>&) noexcept;
+
+public:
+    template<typename Q = K> Iterator<FWD> find(const Q&) noexcept;        //!< find by key
+    template<typename Q = K> Iterator<FWD> lower_bound(const Q&) noexcept; //!< first key not less than
+    template<typename Q = K> Iterator<FWD> upper_bound(const Q&) noexcept; //!< first key greater than
+    Iterator<FWD>                          begin() noexcept;
+    Iterator<FWD>                          end() noexcept;
+
+public:
+    template<typename Q = K> Iterator<FWD | VIEW> find(const Q&) const noexcept;
+    template<typename Q = K> Iterator<FWD | VIEW> lower_bound(const Q&) const noexcept;
+    template<typename Q = K> Iterator<FWD | VIEW> upper_bound(const Q&) const noexcept;
+    Iterator<FWD | VIEW>                          begin() const noexcept;
+    Iterator<FWD | VIEW>                          end() const noexcept;
+
+public:
+    //! @brief visit entries of key in [from, to) in order, F: void(const Entry&)
+    //! @return visited count
+    template<typename Q, typename F> size_t scan(const Q&, const Q&, F&&) const;
+
+public:
+    size_t size() const noexcept;
+    void   clear() noexcept;
+
+private:
+    template<typename T> bool emplace(T&&);
+
+public:
+    TreeBuffer tree;
+};
+
+} // namespace container
+LWE_END
+#include "tree_table.ipp"
+#endif
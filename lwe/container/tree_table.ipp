@@ -0,0 +1,152 @@
+LWE_BEGIN
+namespace container {
+
+template<typename K, typename V, typename A> V& TreeTable<K, V, A>::operator[](const K& in) {
+    Iterator<FWD> it = tree.find(in);
+    if(it != tree.end()) {
+        return it->second;
+    }
+
+    // insert and return
+    // empty data for call constructor
+    bool   created = false;
+    Entry* out     = tree.emplace(Entry{ in, V{} }, &created);
+    if(out == nullptr) {
+        throw diag::error(diag::BAD_ALLOC);
+    }
+    return out->second;
+}
+
+template<typename K, typename V, typename A> const V& TreeTable<K, V, A>::operator[](const K& in) const {
+    return const_cast<TreeTable*>(this)->operator[](in);
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::push(Entry&& in) {
+    return insert(std::move(in));
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::push(const Entry& in) {
+    return insert(in);
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::push(const K& k, const V& v) {
+    return insert(Entry{ k, v });
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::push(K&& k, V&& v) {
+    return insert(Entry{ std::move(k), std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::push(const K& k, V&& v) {
+    return insert(Entry{ k, std::move(v) });
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::push(K&& k, const V& v) {
+    return insert(Entry{ std::move(k), v });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool TreeTable<K, V, A>::pop(const Q& in) noexcept {
+    if(tree.root == nullptr) {
+        return false; // empty
+    }
+
+    Path   path;
+    Leaf*  leaf = tree.descend(in, &path);
+    size_t pos  = TreeBuffer::search(leaf, in);
+    if(pos == leaf->count || in < leaf->data()[pos].first) {
+        return false; // not found
+    }
+    tree.remove(path, leaf, pos);
+    return true;
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> bool TreeTable<K, V, A>::exist(const Q& in) const noexcept {
+    return tree.find(in) != tree.end();
+}
+
+template<typename K, typename V, typename A> bool TreeTable<K, V, A>::erase(const Iterator<FWD>& in) noexcept {
+    return tree.erase(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool TreeTable<K, V, A>::insert(T&& in) {
+    return emplace(std::forward<T>(in));
+}
+
+template<typename K, typename V, typename A>
+template<typename T, typename U> bool TreeTable<K, V, A>::insert(T&& k, U&& v) {
+    return emplace(Entry{ std::forward<T>(k), std::forward<U>(v) });
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto TreeTable<K, V, A>::find(const Q& in) noexcept -> Iterator<FWD> {
+    return tree.find(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto TreeTable<K, V, A>::lower_bound(const Q& in) noexcept -> Iterator<FWD> {
+    return tree.lower_bound(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto TreeTable<K, V, A>::upper_bound(const Q& in) noexcept -> Iterator<FWD> {
+    return tree.upper_bound(in);
+}
+
+template<typename K, typename V, typename A> auto TreeTable<K, V, A>::begin() noexcept -> Iterator<FWD> {
+    return tree.begin();
+}
+
+template<typename K, typename V, typename A> auto TreeTable<K, V, A>::end() noexcept -> Iterator<FWD> {
+    return tree.end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto TreeTable<K, V, A>::find(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeTable*>(this)->find(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto TreeTable<K, V, A>::lower_bound(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeTable*>(this)->lower_bound(in);
+}
+
+template<typename K, typename V, typename A>
+template<typename Q> auto TreeTable<K, V, A>::upper_bound(const Q& in) const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeTable*>(this)->upper_bound(in);
+}
+
+template<typename K, typename V, typename A> auto TreeTable<K, V, A>::begin() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeTable*>(this)->begin();
+}
+
+template<typename K, typename V, typename A> auto TreeTable<K, V, A>::end() const noexcept -> Iterator<FWD | VIEW> {
+    return const_cast<TreeTable*>(this)->end();
+}
+
+template<typename K, typename V, typename A>
+template<typename Q, typename F> size_t TreeTable<K, V, A>::scan(const Q& from, const Q& to, F&& fn) const {
+    return tree.scan(from, to, std::forward<F>(fn));
+}
+
+template<typename K, typename V, typename A> size_t TreeTable<K, V, A>::size() const noexcept {
+    return tree.size();
+}
+
+template<typename K, typename V, typename A> void TreeTable<K, V, A>::clear() noexcept {
+    tree.clear();
+}
+
+template<typename K, typename V, typename A>
+template<typename T> bool TreeTable<K, V, A>::emplace(T&& in) {
+    bool created = false;
+    if(tree.emplace(std::forward<T>(in), &created) == nullptr) {
+        return false; // bad alloc
+    }
+    return created; // false: exist
+}
+
+} // namespace container
+LWE_END
@@ -2,6 +2,7 @@
 #define LWE_MEM_ALLOCATOR
 
 #include "pool.hpp"
+#include "cache.hpp"
 #include "../mem/block.hpp"
 
 LWE_BEGIN
@@ -13,10 +14,15 @@ using namespace config;
 template<typename T, size_t ALIGN = 1> class Allocator {
     using Adapter = Allocator<Block<core::align(sizeof(T), sizeof(void*))>, ALIGN>;
 public:
-    template<typename... Args> static T* allocate(Args&&...) noexcept; //!< @return false: bad alloc
-    static bool                          deallocate(T*) noexcept;      //!< @return false: failed
-    static size_t                        generate(size_t) noexcept;    //!< @return succeeded count
-    static size_t                        release() noexcept;           //!< @return succeeded count
+    template<typename... Args, typename = Single<Args...>>
+    static T*     allocate(Args&&...) noexcept;     //!< @return false: bad alloc
+    static size_t allocate(size_t, T**) noexcept;   //!< batch, default constructed @return allocated count
+    static bool   deallocate(T*) noexcept;          //!< @return false: failed
+    static size_t deallocate(size_t, T**) noexcept; //!< batch, lock once @return freed count
+    static size_t generate(size_t) noexcept;        //!< @return succeeded count
+    static size_t release() noexcept;               //!< @return succeeded count
+    static size_t decay() noexcept;                 //!< @return released count by policy
+    static void   flush() noexcept;                 //!< return thread cache to pool
 };
 
 } // namespace mem
@@ -5,44 +5,97 @@ namespace mem {
 template<size_t SIZE, size_t ALIGN> class Allocator<Block<SIZE>, ALIGN> {
     using Type = Block<SIZE>;
 public:
-    template<typename... Args> static void* allocate(Args&&...) noexcept; //!< @return false: bad alloc
-    static bool                             deallocate(void*) noexcept;   //!< @return false: failed
-    static size_t                           generate(size_t) noexcept;    //!< @return succeeded count
-    static size_t                           release() noexcept;           //!< @return succeeded count
+    template<typename... Args, typename = Single<Args...>>
+    static void*  allocate(Args&&...) noexcept;        //!< @return false: bad alloc
+    static size_t allocate(size_t, void**) noexcept;   //!< batch, cache first @return allocated count
+    static bool   deallocate(void*) noexcept;          //!< @return false: failed
+    static size_t deallocate(size_t, void**) noexcept; //!< batch, lock once @return freed count
+    static size_t generate(size_t) noexcept;           //!< @return succeeded count
+    static size_t release() noexcept;                  //!< @return succeeded count
+    static size_t decay() noexcept;                    //!< @return released count by policy
+    static void   flush() noexcept;                    //!< return thread cache to pool
 private:
+    static Cache&      cache() noexcept; //!< thread-local magazine
     static Pool        pool;
     static async::Lock lock;
 };
 
-template<size_t SIZE, size_t ALIGN> Pool        Allocator<Block<SIZE>, ALIGN>::pool(SIZE, ALIGN);
+template<size_t SIZE, size_t ALIGN> Pool        Allocator<Block<SIZE>, ALIGN>::pool(SIZE, ALIGN, 0, config::HEADERLESS, nullptr, "Allocator");
 template<size_t SIZE, size_t ALIGN> async::Lock Allocator<Block<SIZE>, ALIGN>::lock;
 
+template<size_t SIZE, size_t A> Cache& Allocator<Block<SIZE>, A>::cache() noexcept {
+    thread_local Cache instance(&pool, &lock); // flush on thread exit
+    return instance;
+}
+
 template<size_t SIZE, size_t A>
-template<typename... Args> void* Allocator<Block<SIZE>, A>::allocate(Args&&... in) noexcept {
+template<typename... Args, typename> void* Allocator<Block<SIZE>, A>::allocate(Args&&... in) noexcept {
     void* ptr = nullptr;
-    LOCKGUARD(lock) {
+    if constexpr(config::MAGAZINE != 0) {
+        ptr = cache().get(); // lock only on refill
+    }
+    else LOCKGUARD(lock) {
         ptr = pool.allocate<void>();
     }
     if constexpr(!sizeof...(in)) {
-        new(ptr) Type(std::forward<Args>(in)...);
+        if(ptr) new(ptr) Type(std::forward<Args>(in)...);
     }
     return ptr;
 }
 
-template<size_t SIZE, size_t A> bool Allocator<Block<SIZE>, A>::deallocate(void* in) noexcept {
+template<size_t SIZE, size_t A> size_t Allocator<Block<SIZE>, A>::allocate(size_t size, void** out) noexcept {
+    size_t cnt = 0;
+    if constexpr(config::MAGAZINE != 0) {
+        cnt = cache().get(size, out); // no lock
+    }
+    if(cnt < size) LOCKGUARD(lock) {
+        cnt += pool.allocate(size - cnt, out + cnt);
+    }
+    return cnt;
+}
+
+template<size_t SIZE, size_t A> size_t Allocator<Block<SIZE>, A>::deallocate(size_t size, void** in) noexcept {
+    size_t cnt = 0;
     LOCKGUARD(lock) {
-        return pool.deallocate(in);
+        cnt = pool.deallocate(size, in); // direct, not through cache
+    }
+    return cnt;
+}
+
+template<size_t SIZE, size_t A> bool Allocator<Block<SIZE>, A>::deallocate(void* in) noexcept {
+    if constexpr(config::MAGAZINE != 0) {
+        if(!pool.owns(in)) {
+            return false; // not child, header is read only
+        }
+        cache().set(in); // lock only on flush
+        return true;
+    }
+    else return pool.defer(in); // lock-free, collected by allocate
+}
+
+template<size_t SIZE, size_t A> void Allocator<Block<SIZE>, A>::flush() noexcept {
+    if constexpr(config::MAGAZINE != 0) {
+        cache().flush();
     }
 }
 
 template<size_t SIZE, size_t A> size_t Allocator<Block<SIZE>, A>::release() noexcept {
     size_t cnt = 0;
+    flush(); // this thread cache only
     LOCKGUARD(lock) {
         cnt = pool.release();
     }
     return cnt;
 }
 
+template<size_t SIZE, size_t A> size_t Allocator<Block<SIZE>, A>::decay() noexcept {
+    size_t cnt = 0;
+    LOCKGUARD(lock) {
+        cnt = pool.decay();
+    }
+    return cnt;
+}
+
 template<size_t SIZE, size_t A> size_t Allocator<Block<SIZE>, A>::generate(size_t in) noexcept {
     for(size_t i = 0; i < in; ++i) {
         bool check = false;
@@ -56,7 +109,7 @@ template<size_t SIZE, size_t A> size_t Allocator<Block<SIZE>, A>::generate(size_
 }
 
 template<typename T, size_t A>
-template<typename... Args> T* Allocator<T, A>::allocate(Args&&... in) noexcept {
+template<typename... Args, typename> T* Allocator<T, A>::allocate(Args&&... in) noexcept {
     void* ptr = Adapter::allocate();
     if (!ptr) {
         return nullptr; // bad alloc
@@ -76,10 +129,39 @@ template<typename T, size_t A> bool Allocator<T, A>::deallocate(T* in) noexcept
     return Adapter::deallocate(in);
 }
 
+template<typename T, size_t A> size_t Allocator<T, A>::allocate(size_t size, T** out) noexcept {
+    size_t cnt = Adapter::allocate(size, reinterpret_cast<void**>(out));
+
+    // call constructor
+    if constexpr(!std::is_void_v<T>) {
+        for(size_t i = 0; i < cnt; ++i) {
+            new(out[i]) T();
+        }
+    }
+    return cnt;
+}
+
+template<typename T, size_t A> size_t Allocator<T, A>::deallocate(size_t size, T** in) noexcept {
+    if constexpr(!std::is_void_v<T>) {
+        for(size_t i = 0; i < size; ++i) {
+            if(in[i]) in[i]->~T();
+        }
+    }
+    return Adapter::deallocate(size, reinterpret_cast<void**>(in));
+}
+
 template<typename T, size_t A> size_t Allocator<T, A>::release() noexcept {
     return Adapter::release();
 }
 
+template<typename T, size_t A> size_t Allocator<T, A>::decay() noexcept {
+    return Adapter::decay();
+}
+
+template<typename T, size_t A> void Allocator<T, A>::flush() noexcept {
+    Adapter::flush();
+}
+
 template<typename T, size_t A> size_t Allocator<T, A>::generate(size_t in) noexcept {
     return Adapter::generate(in);
 }
@@ -0,0 +1,121 @@
+#ifndef LWE_MEM_ARENA
+#define LWE_MEM_ARENA
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "provider.hpp"
+
+/*******************************************************************************
+ * monotonic arena
+ *
+ *  page list (kept on reset / rewind)
+ *  +------+-------------------+    +------+---------------------+
+ *  | page | used | ... free   | -> | page | free                | -> nullptr
+ *  +------+-------------------+    +------+---------------------+
+ *                ^                  ^
+ *                curr               next page, reused
+ *
+ * - allocate: bump curr, page end -> next page (reuse or new)
+ * - marker  : current position, rewind(marker) frees everything after it
+ * - reset   : rewind to first page, pages are kept
+ * - release : free unused pages (after curr)
+ * - deallocate: nothing, no destructor call
+ *
+ * frame arena (double buffered)
+ *
+ *  update N  : [ arena 0: current  ] [ arena 1: previous ]
+ *  update N+1: [ arena 0: previous ] [ arena 1: current, reset ]
+ *
+ * - util::Tick::update() flips, previous frame data is valid for one more frame.
+ * - Frame is a container allocator policy, see mem/system.hpp
+ *
+ * NOTE: not thread safe, use on a single (update) thread or per-thread arena.
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+class Arena {
+    struct Page;
+
+public:
+    //! @brief rewind point
+    struct Marker {
+        Page*    page;
+        uint8_t* curr;
+    };
+
+public:
+    static constexpr size_t ALIGN = alignof(std::max_align_t); //!< default alignment
+
+public:
+    //! @param [in] page - page size, default config::BLOCK * 16
+    //! @param [in] provider - page memory source, default nullptr -> Provider::standard()
+    Arena(size_t page = config::BLOCK << 4, Provider* provider = nullptr) noexcept;
+
+public:
+    //! @brief free all pages
+    ~Arena() noexcept;
+
+public:
+    Arena(const Arena&)            = delete;
+    Arena& operator=(const Arena&) = delete;
+
+public:
+    //! @return nullptr: bad alloc
+    void* allocate(size_t size, size_t alignment = ALIGN) noexcept;
+
+public:
+    //! @brief construct object in arena, destructor is not called
+    template<typename T, typename... Args> T* construct(Args&&...);
+
+public:
+    Marker marker() const noexcept;        //!< get rewind point
+    void   rewind(const Marker&) noexcept; //!< back to marker
+    void   reset() noexcept;               //!< back to begin, keep pages
+    size_t release() noexcept;             //!< @return freed page count
+
+public:
+    size_t size() const noexcept;     //!< used bytes, padding included
+    size_t capacity() const noexcept; //!< all page bytes
+
+private:
+    bool next(size_t, size_t) noexcept; //!< move to next page, can fit size
+
+private:
+    struct Page {
+        Page*    next;
+        size_t   size; //!< page size, header included
+        uint8_t* end() noexcept;
+        uint8_t* begin() noexcept;
+    };
+
+private:
+    const size_t PAGE;     //!< default page size
+    Provider*    provider; //!< page source
+    Page*        head = nullptr;
+    Page*        page = nullptr; //!< current page
+    uint8_t*     curr = nullptr; //!< bump pointer
+};
+
+//! @brief double buffered per-frame arena, flipped by util::Tick::update()
+class Frame: Static {
+public:
+    //! @brief container allocator policy
+    static void* allocate(size_t, size_t = Arena::ALIGN) noexcept;
+    static void  deallocate(void*) noexcept; //!< nothing
+
+public:
+    static void   flip() noexcept;     //!< next frame, reset new current
+    static Arena& current() noexcept;  //!< this frame
+    static Arena& previous() noexcept; //!< last frame, valid until next flip
+
+private:
+    inline static Arena  arenas[2];
+    inline static size_t index = 0;
+};
+
+} // namespace mem
+LWE_END
+#include "arena.ipp"
+#endif
@@ -0,0 +1,145 @@
+LWE_BEGIN
+namespace mem {
+
+uint8_t* Arena::Page::begin() noexcept {
+    return reinterpret_cast<uint8_t*>(this) + align(sizeof(Page), ALIGN); // pass header
+}
+
+uint8_t* Arena::Page::end() noexcept {
+    return reinterpret_cast<uint8_t*>(this) + size;
+}
+
+Arena::Arena(size_t page, Provider* provider) noexcept:
+    PAGE{ page > config::BLOCK ? page : config::BLOCK },
+    provider{ provider ? provider : Provider::standard() } { }
+
+Arena::~Arena() noexcept {
+    while(head) {
+        Page* next = head->next;
+        provider->release(head, head->size, ALIGN);
+        head = next;
+    }
+}
+
+void* Arena::allocate(size_t size, size_t alignment) noexcept {
+    if(alignment < 1) {
+        alignment = 1;
+    }
+
+    // first or page end
+    uint8_t* out = page ? reinterpret_cast<uint8_t*>(align(reinterpret_cast<uintptr_t>(curr), alignment)) : nullptr;
+    if(!out || out + size > page->end()) {
+        if(!next(size, alignment)) {
+            return nullptr; // bad alloc
+        }
+        out = reinterpret_cast<uint8_t*>(align(reinterpret_cast<uintptr_t>(curr), alignment));
+    }
+
+    curr = out + size;
+    return out;
+}
+
+template<typename T, typename... Args> T* Arena::construct(Args&&... args) {
+    void* ptr = allocate(sizeof(T), alignof(T));
+    if(!ptr) {
+        return nullptr;
+    }
+    return new(ptr) T(std::forward<Args>(args)...);
+}
+
+auto Arena::marker() const noexcept -> Marker {
+    return Marker{ page, curr };
+}
+
+void Arena::rewind(const Marker& in) noexcept {
+    page = in.page;
+    curr = in.curr;
+}
+
+void Arena::reset() noexcept {
+    rewind(Marker{ nullptr, nullptr });
+}
+
+size_t Arena::release() noexcept {
+    Page** link = page ? &page->next : &head;
+
+    size_t cnt = 0;
+    while(*link) {
+        Page* next = (*link)->next;
+        provider->release(*link, (*link)->size, ALIGN);
+        *link = next;
+        ++cnt;
+    }
+    return cnt;
+}
+
+size_t Arena::size() const noexcept {
+    if(!page) {
+        return 0;
+    }
+    size_t out = 0;
+    for(Page* iter = head; iter != page; iter = iter->next) {
+        out += iter->end() - iter->begin(); // skipped remainder included
+    }
+    return out + (curr - page->begin());
+}
+
+size_t Arena::capacity() const noexcept {
+    size_t out = 0;
+    for(Page* iter = head; iter; iter = iter->next) {
+        out += iter->end() - iter->begin();
+    }
+    return out;
+}
+
+bool Arena::next(size_t size, size_t alignment) noexcept {
+    size_t header = align(sizeof(Page), ALIGN);
+    size_t need   = header + size + alignment; // worst case padding
+
+    // reuse next page
+    Page* candidate = page ? page->next : head;
+    if(candidate && candidate->size >= need) {
+        page = candidate;
+        curr = page->begin();
+        return true;
+    }
+
+    // new page, insert after current
+    size_t bytes = need > PAGE ? align(need, config::BLOCK) : PAGE;
+    Page*  newly = static_cast<Page*>(provider->acquire(bytes, ALIGN));
+    if(!newly) {
+        return false;
+    }
+    newly->size = bytes;
+    newly->next = candidate;
+    if(page) {
+        page->next = newly;
+    }
+    else head = newly;
+
+    page = newly;
+    curr = page->begin();
+    return true;
+}
+
+void* Frame::allocate(size_t size, size_t alignment) noexcept {
+    return arenas[index].allocate(size, alignment);
+}
+
+void Frame::deallocate(void*) noexcept { }
+
+void Frame::flip() noexcept {
+    index ^= 1;
+    arenas[index].reset();
+}
+
+Arena& Frame::current() noexcept {
+    return arenas[index];
+}
+
+Arena& Frame::previous() noexcept {
+    return arenas[index ^ 1];
+}
+
+} // namespace mem
+LWE_END
@@ -0,0 +1,70 @@
+#ifndef LWE_MEM_CACHE
+#define LWE_MEM_CACHE
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../async/lock.hpp"
+#include "pool.hpp"
+
+/*******************************************************************************
+ * thread-local magazine
+ *
+ *    thread A           thread B           thread C
+ *  +----------+       +----------+       +----------+
+ *  | magazine |       | magazine |       | magazine |  << per thread, no lock
+ *  +----+-----+       +----+-----+       +----+-----+
+ *       |                  |                  |
+ *       +------------------+------------------+  << refill: lock once per batch
+ *                          |                        flush : remote free, no lock
+ *                     +----+----+
+ *                     |  Pool   |  << shared
+ *                     +---------+
+ *
+ * - get: pop from magazine, empty -> refill half from pool (batch)
+ * - set: push to magazine, full   -> flush half to pool
+ * - thread exit: flush all to pool
+ *
+ * NOTE: magazine size is config::MAGAZINE, 0 is disable (always lock)
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+//! @brief per-thread chunk cache in front of a shared pool
+class Cache {
+    static constexpr size_t SIZE  = config::MAGAZINE ? config::MAGAZINE : 1; //!< stack size
+    static constexpr size_t BATCH = SIZE > 1 ? (SIZE >> 1) : 1;              //!< refill / flush unit
+
+public:
+    //! @param [in] Pool* shared pool
+    //! @param [in] Lock* lock of shared pool
+    Cache(Pool*, async::Lock*) noexcept;
+
+public:
+    //! @brief flush all to pool
+    ~Cache() noexcept;
+
+public:
+    void*  get() noexcept;               //!< @return nullptr: bad alloc
+    size_t get(size_t, void**) noexcept; //!< pop cached only, no refill @return popped count
+    void   set(void*) noexcept;          //!< push, flush half when full
+    void   flush() noexcept;             //!< return all to pool
+
+public:
+    size_t size() const noexcept; //!< cached chunk count
+
+private:
+    bool refill() noexcept;      //!< pool -> magazine
+    void drain(size_t) noexcept; //!< magazine -> pool
+
+private:
+    Pool*        pool;
+    async::Lock* lock;
+    size_t       counter = 0;
+    void*        stack[SIZE];
+};
+
+} // namespace mem
+LWE_END
+#include "cache.ipp"
+#endif
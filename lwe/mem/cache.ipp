@@ -0,0 +1,57 @@
+LWE_BEGIN
+namespace mem {
+
+Cache::Cache(Pool* pool, async::Lock* lock) noexcept: pool(pool), lock(lock) { }
+
+Cache::~Cache() noexcept {
+    flush();
+}
+
+void* Cache::get() noexcept {
+    if(counter == 0 && !refill()) {
+        return nullptr; // bad alloc
+    }
+    return stack[--counter];
+}
+
+size_t Cache::get(size_t size, void** out) noexcept {
+    size_t cnt = size < counter ? size : counter;
+    for(size_t i = 0; i < cnt; ++i) {
+        out[i] = stack[--counter];
+    }
+    return cnt;
+}
+
+void Cache::set(void* in) noexcept {
+    if(counter == SIZE) {
+        drain(BATCH); // keep half for next get
+    }
+    stack[counter++] = in;
+}
+
+void Cache::flush() noexcept {
+    drain(counter);
+}
+
+size_t Cache::size() const noexcept {
+    return counter;
+}
+
+bool Cache::refill() noexcept {
+    LOCKGUARD(*lock) {
+        counter += pool->allocate(BATCH - counter, stack + counter); // bad alloc: return what we have
+    }
+    return counter != 0;
+}
+
+void Cache::drain(size_t in) noexcept {
+    if(in == 0) {
+        return;
+    }
+    for(size_t i = 0; i < in; ++i) {
+        pool->defer<void>(stack[--counter]); // lock-free, top first
+    }
+}
+
+} // namespace mem
+LWE_END
@@ -0,0 +1,89 @@
+#ifndef LWE_MEM_HEAP
+#define LWE_MEM_HEAP
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../async/lock.hpp"
+#include "pool.hpp"
+#include "cache.hpp"
+
+/*******************************************************************************
+ * size-class heap
+ *
+ * allocate(size)
+ *   |
+ *   +-> size <= LARGE: class table -> Pool (chunk header mode) + magazine
+ *   |
+ *   +-> size >  LARGE: memalloc with header
+ *
+ * classes:
+ *  8, 16 ~ 128 (step 16), 160 ~ 256 (step 32), 320 ~ 512 (step 64), 640 ~ 1024 (step 128)
+ *
+ * deallocate(ptr): read word before ptr
+ *
+ *         small chunk                         large object
+ *  +---------+----------------+     +-------+---------+----------------+
+ *  | Block*  | data ...       |     | size  | &LARGE  | data ...       |
+ *  +---------+----------------+     +-------+---------+----------------+
+ *            ^ ptr                                    ^ ptr
+ *
+ *  - &LARGE: large object marker, size is user size
+ *  - Block* : Block::from -> Pool -> chunk size -> class table
+ *
+ * NOTE: class pools always use chunk header, even if config::HEADERLESS.
+ * NOTE: pointer given to deallocate / reallocate / size must come from Heap, ownership is not checked.
+ * NOTE: LARGE is 1024 or config::BLOCK / 4 if smaller, so each block has several chunks.
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+//! @brief general purpose allocator, free without type
+class Heap {
+    template<size_t N> class Class; //!< pool for each size class
+
+    //! @brief class table entry
+    struct Entry {
+        void* (*allocate)() noexcept;
+        bool (*deallocate)(void*) noexcept;
+        void (*flush)() noexcept;
+        size_t (*release)() noexcept;
+        size_t (*decay)() noexcept;
+        Pool*  pool;
+        size_t size;
+    };
+
+    static constexpr size_t SIZES[] = {
+        8,   16,  32,  48,  64,  80,  96,  112, 128, 160, 192,
+        224, 256, 320, 384, 448, 512, 640, 768, 896, 1'024,
+    };                                                                           //!< class sizes
+    static constexpr size_t COUNT = sizeof(SIZES) / sizeof(size_t);              //!< class count
+    static constexpr size_t LARGE = SIZES[COUNT - 1] < (config::BLOCK >> 2) ?    //!< max class size
+                                        SIZES[COUNT - 1] :
+                                        (config::BLOCK >> 2);
+    static constexpr size_t HEAD  = sizeof(size_t) + sizeof(void*);              //!< large object header
+
+public:
+    static void*  allocate(size_t) noexcept;          //!< @return nullptr: bad alloc
+    static bool   deallocate(void*) noexcept;         //!< in from allocate, @return false: nullptr
+    static void*  reallocate(void*, size_t) noexcept; //!< in from allocate, @return nullptr: bad alloc, in kept
+    static size_t size(const void*) noexcept;         //!< in from allocate, @return usable size, 0: nullptr
+    static void   flush() noexcept;                   //!< return thread cache to pools
+    static size_t release() noexcept;                 //!< @return freed block count
+    static size_t decay() noexcept;                   //!< @return freed block count by pool policy
+
+private:
+    static size_t       indexof(size_t) noexcept; //!< size -> class index, COUNT: large
+    static const Entry* entryof(void*) noexcept;  //!< chunk from allocate -> class entry, nullptr: large
+    static const Entry* table() noexcept;         //!< class table
+
+    template<size_t... I> static const Entry* table(std::index_sequence<I...>) noexcept;
+
+private:
+    static constexpr char MARKER = 0; //!< address is large object marker
+};
+
+} // namespace mem
+LWE_END
+#include "heap.ipp"
+#endif
@@ -0,0 +1,232 @@
+LWE_BEGIN
+namespace mem {
+
+//! @brief static pool for a size class
+template<size_t N> class Heap::Class {
+public:
+    static void*  allocate() noexcept;
+    static bool   deallocate(void*) noexcept;
+    static void   flush() noexcept;
+    static size_t release() noexcept;
+    static size_t decay() noexcept;
+
+private:
+    static Cache& cache() noexcept; //!< thread-local magazine
+
+public:
+    static Pool        pool;
+    static async::Lock lock;
+};
+
+// chunk header is required to find class, malloc compatible alignment from 16
+template<size_t N> Pool        Heap::Class<N>::pool(N, N < 16 ? sizeof(void*) : 16, 0, false, nullptr, "Heap");
+template<size_t N> async::Lock Heap::Class<N>::lock;
+
+template<size_t N> Cache& Heap::Class<N>::cache() noexcept {
+    thread_local Cache instance(&pool, &lock); // flush on thread exit
+    return instance;
+}
+
+template<size_t N> void* Heap::Class<N>::allocate() noexcept {
+    if constexpr(config::MAGAZINE != 0) {
+        return cache().get();
+    }
+    else LOCKGUARD(lock) {
+        return pool.allocate<void>();
+    }
+    return nullptr;
+}
+
+template<size_t N> bool Heap::Class<N>::deallocate(void* in) noexcept {
+    if constexpr(config::MAGAZINE != 0) {
+        cache().set(in); // owner is checked by heap
+        return true;
+    }
+    else return pool.defer(in);
+}
+
+template<size_t N> void Heap::Class<N>::flush() noexcept {
+    if constexpr(config::MAGAZINE != 0) {
+        cache().flush();
+    }
+}
+
+template<size_t N> size_t Heap::Class<N>::release() noexcept {
+    size_t cnt = 0;
+    flush();
+    LOCKGUARD(lock) {
+        cnt = pool.release();
+    }
+    return cnt;
+}
+
+template<size_t N> size_t Heap::Class<N>::decay() noexcept {
+    size_t cnt = 0;
+    LOCKGUARD(lock) {
+        cnt = pool.decay();
+    }
+    return cnt;
+}
+
+template<size_t... I> auto Heap::table(std::index_sequence<I...>) noexcept -> const Entry* {
+    static const Entry entries[] = {
+        Entry{ &Class<SIZES[I]>::allocate,
+              &Class<SIZES[I]>::deallocate,
+              &Class<SIZES[I]>::flush,
+              &Class<SIZES[I]>::release,
+              &Class<SIZES[I]>::decay,
+              &Class<SIZES[I]>::pool,
+              SIZES[I] }...
+    };
+    return entries;
+}
+
+auto Heap::table() noexcept -> const Entry* {
+    return table(std::make_index_sequence<COUNT>{});
+}
+
+size_t Heap::indexof(size_t in) noexcept {
+    // 8 bytes unit lookup: (size + 7) / 8 -> class index
+    static constexpr auto LOOKUP = []() {
+        struct {
+            uint8_t index[(SIZES[COUNT - 1] >> 3) + 1];
+        } out{};
+        size_t cls = 0;
+        for(size_t i = 0; i <= (SIZES[COUNT - 1] >> 3); ++i) {
+            while(SIZES[cls] < (i << 3)) ++cls;
+            out.index[i] = static_cast<uint8_t>(cls);
+        }
+        return out;
+    }();
+
+    if(in > LARGE) {
+        return COUNT;
+    }
+    return LOOKUP.index[(in + 7) >> 3];
+}
+
+auto Heap::entryof(void* in) noexcept -> const Entry* {
+    // word before chunk is trusted, caller passes heap memory only
+    void* mark = *(reinterpret_cast<void**>(in) - 1);
+    if(mark == &MARKER) {
+        return nullptr; // large
+    }
+
+    Pool::Block* block = static_cast<Pool::Block*>(mark);
+    if(!block || !block->from) {
+        return nullptr;
+    }
+
+    size_t index = indexof(block->from->SRC);
+    if(index == COUNT) {
+        return nullptr;
+    }
+
+    const Entry* entry = table() + index;
+    if(entry->pool != block->from) {
+        return nullptr; // other pool
+    }
+    return entry;
+}
+
+void* Heap::allocate(size_t in) noexcept {
+    size_t index = indexof(in);
+    if(index != COUNT) {
+        return table()[index].allocate();
+    }
+
+    // large
+    uint8_t* ptr = memalloc<uint8_t>(HEAD + in, 16);
+    if(!ptr) {
+        return nullptr; // bad alloc
+    }
+    *reinterpret_cast<size_t*>(ptr)                       = in;
+    *reinterpret_cast<const void**>(ptr + sizeof(size_t)) = &MARKER;
+    return ptr + HEAD;
+}
+
+bool Heap::deallocate(void* in) noexcept {
+    if(!in) {
+        return false;
+    }
+
+    if(*(reinterpret_cast<void**>(in) - 1) == &MARKER) {
+        memfree(static_cast<uint8_t*>(in) - HEAD); // large
+        return true;
+    }
+
+    const Entry* entry = entryof(in);
+    if(!entry) {
+        return false; // broken header
+    }
+    return entry->deallocate(in);
+}
+
+void* Heap::reallocate(void* in, size_t size) noexcept {
+    if(!in) {
+        return allocate(size);
+    }
+
+    if(size == 0) {
+        deallocate(in);
+        return nullptr;
+    }
+
+    size_t prev = Heap::size(in); // in from heap, never 0
+
+    // same class, keep
+    size_t index = indexof(size);
+    if(index != COUNT && index == indexof(prev)) {
+        return in;
+    }
+
+    void* out = allocate(size);
+    if(!out) {
+        return nullptr; // bad alloc, keep input
+    }
+    std::memcpy(out, in, prev < size ? prev : size);
+    deallocate(in);
+    return out;
+}
+
+size_t Heap::size(const void* in) noexcept {
+    if(!in) {
+        return 0;
+    }
+
+    void* ptr = const_cast<void*>(in);
+    if(*(reinterpret_cast<void**>(ptr) - 1) == &MARKER) {
+        return *reinterpret_cast<size_t*>(static_cast<uint8_t*>(ptr) - HEAD); // large
+    }
+
+    const Entry* entry = entryof(ptr);
+    return entry ? entry->size : 0;
+}
+
+void Heap::flush() noexcept {
+    const Entry* entries = table();
+    for(size_t i = 0; i < COUNT; ++i) {
+        entries[i].flush();
+    }
+}
+
+size_t Heap::release() noexcept {
+    size_t       cnt     = 0;
+    const Entry* entries = table();
+    for(size_t i = 0; i < COUNT; ++i) {
+        cnt += entries[i].release();
+    }
+    return cnt;
+}
+
+size_t Heap::decay() noexcept {
+    size_t       cnt     = 0;
+    const Entry* entries = table();
+    for(size_t i = 0; i < COUNT; ++i) {
+        cnt += entries[i].decay();
+    }
+    return cnt;
+}
+
+} // namespace mem
+LWE_END
@@ -5,6 +5,9 @@
 #include "../config/config.h"
 #include "../async/lock.hpp"
 #include "../container/hashed_buffer.hpp"
+#include "../container/linear_buffer.hpp"
+#include <algorithm>
+#include "provider.hpp"
 
 /*******************************************************************************
  * pool structure
@@ -14,15 +17,15 @@
  *  - align: 32
  *  - count: 2
  *
- * 192                 256                384         512 | << address
- * ^                   ^                  ^           ^   |
- * +-------+----+------+------+----+------+------+----+   |
- * | block |    | meta | data |    | meta | data |    |   |
- * +-------+----+------+------+----+------+------+----+   |
- *         | 16 |             | 24 |             | 32 |   | << padding
- *              +--- chunk ---+    +--- chunk ---+
+ * 192                        288                416         544 | << address
+ * ^                          ^                  ^           ^   |
+ * +-------+-----------+------+------+----+------+------+----+   |
+ * | block |           | meta | data |    | meta | data |    |   |
+ * +-------+-----------+------+------+----+------+------+----+   |
+ *         |    24     |             | 24 |             | 32 |   | << padding
+ *                     +--- chunk ---+    +--- chunk ---+
  *
- * total: 320 bytes (64 + 128 * 2)
+ * total: 352 bytes (96 + 128 * 2)
  *
  * - block : block header (struct) like a node
  *   |-[ 8 bytes]: next chunk pointer
@@ -30,7 +33,9 @@
  *   |-[ 8 bytes]: prev block pointer
  *   |-[ 8 bytes]: outer pool pointer
  *   |-[ 8 bytes]: using chunk count
- *   +-[16 bytes]: padding
+ *   |-[ 8 bytes]: remote freed chunk list (atomic)
+ *   |-[ 8 bytes]: next pending block pointer
+ *   +-[ 8 bytes]: freeable timestamp (ms)
  *
  * - chunk: not a struct, abstract object for dynamic chunk size.
  *   |-[ 8 bytes]: outer block address (meta)
@@ -40,13 +45,106 @@
  * NOTE: align is intended for SIMD use and increases capacity.
  * block header padding reason: to ensures alignment for chunk start addresses.
  *
+ ******************************************************************************
+ * headerless mode
+ *
+ * same configuration
+ *
+ * 4096    4160         4256         4352 | << address
+ * ^       ^            ^            ^    |
+ * +-------+------------+------------+    |
+ * | block | data       | data       |    |
+ * +-------+------------+------------+    |
+ *
+ * total: 256 bytes (64 + 96 * 2), aligned to 256
+ *
+ * - chunk: 96 bytes, no meta, no padding (96 is multiple of 32)
+ * - block: allocated to power of 2 size and aligned to own size
+ * - find : chunk address & ~(block size - 1)
+ *
+ * NOTE: config::HEADERLESS sets default, pointer from other source can not be checked.
+ *
+ ******************************************************************************
+ * remote free
+ *
+ *  any thread                    owner (lock holder)
+ *  ----------                    -------------------
+ *  defer(chunk)                  allocate() / collect() / release()
+ *    |                             |
+ *    +-> block.remote  <- CAS      +-> pending.exchange(nullptr)
+ *        |                         |     for each block:
+ *        +-> was empty?            |       block.remote.exchange(nullptr)
+ *            pool.pending <- CAS   |       return chunks to block
+ *
+ * - defer does not touch curr / used, the owner applies them on collect.
+ * - a block is in the pending list at most once, remote != nullptr until collected.
+ *
+ ******************************************************************************
+ * decay
+ *
+ *  freeable queue: head (oldest) ... tail (newest)
+ *
+ * - generate reuses the newest freeable block (tail), still warm.
+ * - decay releases from the oldest while freeable count > retain and idle >= delay.
+ * - released block goes back to provider, see Region::purge for returning to OS.
+ *
+ ******************************************************************************
+ * batch
+ *
+ *  allocate(n, out)
+ *   +-> usable.head: [ c0 -> c1 -> c2 -> ... ] take run, one curr / used update
+ *   +-> block empty: dequeue, next block (collect / generate) until n
+ *
+ *  deallocate(n, in)
+ *   +-> same block run: [ in[i], in[i + 1], ... ] one queue update per run
+ *
+ * - caller owns the pool once for the whole batch (e.g. one lock).
+ * - (integer, T**) arguments select batch, not constructor arguments.
+ *
+ ******************************************************************************
+ * telemetry
+ *
+ *  registry: every live pool, linked on construct / unlinked on destroy
+ *   head -> [ Allocator<Block<16>> ] -> [ Heap::Class<32> ] -> [ Object ] -> ...
+ *
+ * - count    : counter snapshot with peaks, any thread (owner writes, relaxed atomic)
+ * - padding  : wasted bytes per chunk (header + alignment)
+ * - occupancy: block histogram by used chunks, fragmentation, owner only
+ * - report   : table of all live pools from counters, any thread
+ *
+ * NOTE: unpooled (count <= 1) chunks are not counted.
+ *
+ ******************************************************************************
+ * live
+ *
+ *  blocks sorted by address
+ *   [ block 0 ][ block 1 ] ...
+ *       |
+ *       +-> free list -> bitmap [ 0 1 0 0 1 ... ] -> visit 0 chunks in order
+ *
+ * - deferred chunks are collected first, they are not live.
+ * - F must not allocate from the pool, defer is fine.
+ *
  ******************************************************************************/
 
 LWE_BEGIN
 
 namespace mem {
 
+class Heap;
+
+//! @brief batch call check: (count, T** out)
+template<typename... Args> struct Batch: std::false_type { };
+template<typename N, typename P> struct Batch<N, P>
+    : std::bool_constant<std::is_integral_v<std::decay_t<N>> &&
+                         std::is_pointer_v<std::remove_pointer_t<std::decay_t<P>>>> { };
+
+//! @brief SFINAE for single object allocate
+template<typename... Args> using Single = std::enable_if_t<!Batch<Args...>::value>;
+
 class Pool {
+    friend class Heap; //!< find size class from chunk
+
 protected:
     //! @brief memory pool block node
     //! @note  4 pointer = 32 byte in x64
@@ -66,19 +164,63 @@ protected:
     } usable, freeable;
 
 public:
-    //! @brief block counter
+    //! @brief block counter snapshot
     struct Counter {
         size_t generated; //!< block generated count
         size_t blocks;    //!< number of blocks in use
-        size_t chunks;    //!< number of chunks in use
+        size_t chunks;    //!< number of chunks in use, deferred chunks included until collect
+
+        //! @brief high-water marks
+        struct {
+            size_t generated;
+            size_t blocks;
+            size_t chunks;
+        } peak;
+    };
+
+protected:
+    //! @brief counter written by owner only, read from any thread
+    struct Gauge {
+        Gauge& operator+=(size_t) noexcept; //!< add, update peak
+        Gauge& operator-=(size_t) noexcept; //!< sub
+        Gauge& operator++() noexcept;       //!< add 1
+        Gauge& operator--() noexcept;       //!< sub 1
+        operator size_t() const noexcept;   //!< current value
+
+        std::atomic<size_t> value{ 0 };
+        std::atomic<size_t> peak{ 0 };
+    };
+
+    struct {
+        Gauge generated;
+        Gauge blocks;
+        Gauge chunks;
     } counter;
 
+public:
+    //! @brief freeable block release policy
+    struct Decay {
+        size_t retain; //!< freeable block count always kept
+        size_t delay;  //!< idle time (ms) before release
+    } policy;
+
+public:
+    static constexpr size_t BINS = 8; //!< occupancy histogram bins
+
 public:
     //! @brief construct a new pool object
     //! @param [in] chunk - chunk size, it is padded to the pointer size.
     //! @param [in] align - chunk align, it is adjusted to the power of 2, min -> sizeof(void*)
     //! @param [in] count - chunk count in block, default 0 -> auto
-    Pool(size_t chunk, size_t alignment = 0, size_t count = 0) noexcept;
+    //! @param [in] headerless - no outer block address in chunk, block is aligned to own size
+    //! @param [in] provider - block memory source, default nullptr -> Provider::standard()
+    //! @param [in] name - report name, default nullptr -> "Pool"
+    Pool(size_t      chunk,
+         size_t      alignment  = 0,
+         size_t      count      = 0,
+         bool        headerless = config::HEADERLESS,
+         Provider*   provider   = nullptr,
+         const char* name       = nullptr) noexcept;
 
 public:
     //! @brief destroy the pool object.
@@ -86,16 +228,51 @@ public:
 
 public:
     //! @brief get memory, call malloc when top is null and garbage collector is empty.
-    template<typename T = void, typename... Args> T* allocate(Args&&...) noexcept;
+    template<typename T = void, typename... Args, typename = Single<Args...>> T* allocate(Args&&...) noexcept;
+
+public:
+    //! @brief get memory in batch, default constructed if T is not void.
+    //! @return allocated count, less than count: bad alloc
+    template<typename T> size_t allocate(size_t, T**) noexcept;
 
 public:
     //! @brief return memory, if not child of pool, push to garbage collector of outer pool.
     template<typename T = void> bool deallocate(T*) noexcept;
 
+public:
+    //! @brief return memory in batch, not child of pool and nullptr are skipped.
+    //! @return returned count
+    template<typename T> size_t deallocate(size_t, T**) noexcept;
+
+public:
+    //! @brief return memory from any thread without lock, applied on next collect.
+    template<typename T = void> bool defer(T*) noexcept;
+
+public:
+    //! @brief apply deferred chunks, caller must own the pool like allocate.
+    //! @return collected chunk count
+    size_t collect() noexcept;
+
+protected:
+    //! @brief return chunk to block, update queues and counter.
+    void reclaim(Block*, void*) noexcept;
+
+protected:
+    //! @brief return chunks of same block, update queues and counter once.
+    void reclaim(Block*, void**, size_t) noexcept;
+
 protected:
     //! @brief generate block.
     bool generate() noexcept;
 
+protected:
+    //! @brief get outer block of chunk, by mask or by chunk header.
+    Block* find(const void*) const noexcept;
+
+protected:
+    //! @brief free block memory
+    void destroy(Block*) noexcept;
+
 public:
     //! @brief generate blocks.
     size_t generate(size_t size) noexcept;
@@ -105,34 +282,95 @@ public:
     size_t release() noexcept;
 
 public:
-    //! @brief get pool state
+    //! @brief free freeable blocks by policy, caller must own the pool like allocate.
+    //! @return freed block count
+    size_t decay() noexcept;
+
+public:
+    //! @brief get pool state, any thread
     Counter count() const noexcept;
 
+public:
+    //! @brief wasted bytes per chunk, chunk header and alignment padding
+    size_t padding() const noexcept;
+
+public:
+    //! @brief block occupancy histogram, bin: used chunks * BINS / count, full block -> last bin
+    //! @note  caller must own the pool like allocate
+    void occupancy(size_t (&)[BINS]) const noexcept;
+
+public:
+    //! @brief visit live chunks in address order, F: void(void*)
+    //! @note  caller must own the pool like allocate, unpooled (count <= 1) is not visited
+    //! @return visited count
+    //! @throw diag::error(BAD_ALLOC)
+    template<typename F> size_t live(F&&);
+
+public:
+    //! @brief visit all live pools under registry lock, F: void(const Pool&)
+    template<typename F> static void each(F&&);
+
+public:
+    //! @brief live pool table from counters, any thread
+    static String report();
+
+public:
+    //! @brief check chunk is child of pool, always true when unpooled (count <= 1)
+    bool owns(const void*) const noexcept;
+
 protected:
     const size_t ALIGN; //!< chunk alignment
     const size_t CHUNK; //!< chunk size
     const size_t META;  //!< block header size
     const size_t COUNT; //!< chunk count
     const size_t SRC;   //!< chunk origianl size
+    const size_t MASK;  //!< block address mask, 0: chunk header mode
+    const size_t SPAN;  //!< block allocation size
+
+public:
+    const char* NAME; //!< report name
+
+protected:
+    Provider* provider; //!< block source
 
 protected:
-    container::HashedBuffer<Block*> all; //!<  generated blocks
+    container::HashedBuffer<Block*> all;     //!<  generated blocks
+    std::atomic<Block*>             pending; //!<  blocks with remote freed chunks
+
+private:
+    //! @brief live pool list
+    struct Registry {
+        async::Lock lock;
+        Pool*       head = nullptr;
+    };
+
+    static Registry& registry() noexcept;
+
+private:
+    Pool* prev = nullptr; //!< registry list
+    Pool* next = nullptr; //!< registry list
 };
 
 struct Pool::Block {
-    void  initialize(Pool*, size_t) noexcept;
-    void* get() noexcept;
-    void  set(void*) noexcept;
-    bool  full() const noexcept;
-    bool  empty() const noexcept;
+    void   initialize(Pool*, size_t) noexcept;
+    void*  get() noexcept;
+    size_t get(size_t, void**) noexcept; //!< take run of free list
+    void   set(void*) noexcept;
+    bool   full() const noexcept;
+    bool   empty() const noexcept;
+
+    void push(void*) noexcept;
 
     static Block* find(void*) noexcept;
 
-    Pool*  from;
-    void*  curr;
-    Block* next;
-    Block* prev;
-    size_t used;
+    Pool*              from;
+    void*              curr;
+    Block*             next;
+    Block*             prev;
+    size_t             used;
+    std::atomic<void*> remote; //!< chunks freed by other thread
+    Block*             link;   //!< next block in pending list
+    uint64_t           time;   //!< freeable since (ms)
 };
 
 } // namespace mem
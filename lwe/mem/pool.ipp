@@ -8,23 +8,30 @@ void Pool::Block::initialize(Pool* outer, size_t count) noexcept {
 
     uint8_t* data = reinterpret_cast<uint8_t*>(this) + from->META; // pass header
     uint8_t* meta = data - sizeof(void*);                          // pass pointer
+    bool     head = from->MASK == 0;                               // headerless: no outer
 
     curr = reinterpret_cast<void*>(data); // save
 
     // write outer end next
     size_t loop = count - 1;
     for(size_t i = 0; i < loop; ++i) {
-        *reinterpret_cast<void**>(meta) = reinterpret_cast<void*>(this);               // outer
+        if(head) {
+            *reinterpret_cast<void**>(meta) = reinterpret_cast<void*>(this); // outer
+        }
         *reinterpret_cast<void**>(data) = reinterpret_cast<void*>(data + from->CHUNK); // next
 
         meta += from->CHUNK;
         data += from->CHUNK;
     }
 
-    *reinterpret_cast<void**>(meta) = reinterpret_cast<void*>(this);
+    if(head) {
+        *reinterpret_cast<void**>(meta) = reinterpret_cast<void*>(this);
+    }
     *reinterpret_cast<void**>(data) = nullptr;
 
     used = 0;
+    link = nullptr;
+    remote.store(nullptr, std::memory_order_relaxed);
 }
 
 void* Pool::Block::get() noexcept {
@@ -42,6 +49,21 @@ void* Pool::Block::get() noexcept {
     return out;
 }
 
+size_t Pool::Block::get(size_t size, void** out) noexcept {
+    size_t cnt  = 0;
+    void*  iter = curr;
+
+    // walk free list, no per chunk state update
+    while(iter && cnt < size) {
+        out[cnt++] = iter;
+        iter       = *reinterpret_cast<void**>(iter);
+    }
+
+    curr  = iter;
+    used += cnt;
+    return cnt;
+}
+
 void Pool::Block::set(void* in) noexcept {
     if(!in) return;
 
@@ -60,6 +82,21 @@ bool Pool::Block::empty() const noexcept {
     return curr == nullptr;
 }
 
+void Pool::Block::push(void* in) noexcept {
+    void* head = remote.load(std::memory_order_relaxed);
+    do {
+        *reinterpret_cast<void**>(in) = head; // set next
+    } while(!remote.compare_exchange_weak(head, in, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    // first remote chunk: notify to pool
+    if(head == nullptr) {
+        Block* top = from->pending.load(std::memory_order_relaxed);
+        do {
+            link = top;
+        } while(!from->pending.compare_exchange_weak(top, this, std::memory_order_release, std::memory_order_relaxed));
+    }
+}
+
 auto Pool::Block::find(void* in) noexcept -> Block* {
     if(in) {
         void* ptr = reinterpret_cast<void**>(in) - 1;
@@ -68,26 +105,196 @@ auto Pool::Block::find(void* in) noexcept -> Block* {
     return nullptr;
 }
 
-Pool::Pool(size_t chunk, size_t alignment, size_t count) noexcept:
-    ALIGN{ alignment <= sizeof(void*) ? sizeof(void*) : align(alignment) }, // align min: ptr size (64-bits: 8)
-    CHUNK{ align(chunk + sizeof(void*), ALIGN) },                           // with ptr for outer block address
-    META{ align(sizeof(Block) + sizeof(void*), ALIGN) },                    // padding for first chunk alignment
-    COUNT{ count ? count : ((config::BLOCK - META) / CHUNK) },              // adjust for mem page size
-    SRC{ chunk },                                                           // chunk original size backup
-    counter{ 0 } { }
+Pool::Pool(size_t chunk, size_t alignment, size_t count, bool headerless, Provider* provider, const char* name) noexcept:
+    policy{ config::RETAIN, config::DECAY },
+    ALIGN{ alignment <= sizeof(void*) ? sizeof(void*) : align(alignment) },         // align min: ptr size (64-bits: 8)
+    CHUNK{ align(chunk + (headerless ? 0 : sizeof(void*)), ALIGN) },                // with ptr for outer block address
+    META{ align(sizeof(Block) + (headerless ? 0 : sizeof(void*)), ALIGN) },         // padding for first chunk alignment
+    COUNT{ count ? count : ((config::BLOCK - META) / CHUNK) },                      // adjust for mem page size
+    SRC{ chunk },                                                                   // chunk original size backup
+    MASK{ headerless && COUNT > 1 ? ~(align(META + (CHUNK * COUNT)) - 1) : 0 },     // block size is power of 2
+    SPAN{ MASK ? ~MASK + 1 : META + (CHUNK * COUNT) },                              // block size
+    NAME{ name ? name : "Pool" },
+    provider{ provider ? provider : Provider::standard() },
+    pending{ nullptr } {
+    // link to registry
+    Registry& reg = registry();
+    LOCKGUARD(reg.lock) {
+        next = reg.head;
+        if(next) {
+            next->prev = this;
+        }
+        reg.head = this;
+    }
+}
 
 Pool::~Pool() noexcept {
+    // unlink from registry
+    Registry& reg = registry();
+    LOCKGUARD(reg.lock) {
+        if(prev) prev->next = next;
+        else reg.head = next;
+        if(next) next->prev = prev;
+    }
+
     // assert(counter.chunks == 0);
     for(auto i = all.begin(); i != all.end(); ++i) {
-        memfree(*i);
+        destroy(*i);
     }
 }
 
 auto Pool::count() const noexcept -> Counter {
-    return counter;
+    Counter out;
+    out.generated      = counter.generated;
+    out.blocks         = counter.blocks;
+    out.chunks         = counter.chunks;
+    out.peak.generated = counter.generated.peak.load(std::memory_order_relaxed);
+    out.peak.blocks    = counter.blocks.peak.load(std::memory_order_relaxed);
+    out.peak.chunks    = counter.chunks.peak.load(std::memory_order_relaxed);
+    return out;
+}
+
+size_t Pool::padding() const noexcept {
+    return CHUNK - SRC;
+}
+
+void Pool::occupancy(size_t (&out)[BINS]) const noexcept {
+    for(size_t i = 0; i < BINS; ++i) {
+        out[i] = 0;
+    }
+    if(COUNT <= 1) return;
+
+    for(auto i = all.begin(); i != all.end(); ++i) {
+        size_t used = (*i)->used;
+        ++out[used >= COUNT ? BINS - 1 : used * BINS / COUNT];
+    }
+}
+
+template<typename F> size_t Pool::live(F&& fn) {
+    if(COUNT <= 1) return 0;
+
+    collect(); // deferred chunks are not live
+
+    // memory order
+    container::LinearBuffer<Block*>  blocks;
+    container::LinearBuffer<uint8_t> vacant; // free list mark of chunks
+    if(!blocks.reserve(all.size()) || !vacant.resize(COUNT)) {
+        throw diag::error(diag::BAD_ALLOC);
+    }
+    for(auto i = all.begin(); i != all.end(); ++i) {
+        blocks.push(*i);
+    }
+    std::sort(blocks.data(), blocks.data() + blocks.size());
+
+    size_t cnt = 0;
+    for(Block* block : blocks) {
+        if(block->used == 0) {
+            continue; // freeable
+        }
+
+        // mark free list
+        uint8_t* data = reinterpret_cast<uint8_t*>(block) + META;
+        std::memset(vacant.data(), 0, COUNT);
+        for(void* iter = block->curr; iter; iter = *reinterpret_cast<void**>(iter)) {
+            vacant[(static_cast<uint8_t*>(iter) - data) / CHUNK] = 1;
+        }
+
+        for(size_t i = 0; i < COUNT; ++i) {
+            if(!vacant[i]) {
+                fn(static_cast<void*>(data + (i * CHUNK)));
+                ++cnt;
+            }
+        }
+    }
+    return cnt;
 }
 
-template<typename T, typename... Args> T* Pool::allocate(Args&&... args) noexcept {
+template<typename F> void Pool::each(F&& fn) {
+    Registry& reg = registry();
+    LOCKGUARD(reg.lock) {
+        for(const Pool* iter = reg.head; iter; iter = iter->next) {
+            fn(*iter);
+        }
+    }
+}
+
+String Pool::report() {
+    static constexpr size_t KIB = 1'024;
+
+    char   line[256];
+    String out;
+    size_t reserved = 0;
+    size_t used     = 0;
+    size_t wasted   = 0;
+
+    snprintf(line,
+             sizeof(line),
+             "%-12s %7s %7s %5s %4s %15s %21s %11s %11s %11s %5s\n",
+             "name",
+             "size",
+             "chunk",
+             "align",
+             "mode",
+             "blocks(peak)",
+             "chunks(peak)",
+             "reserved",
+             "used",
+             "padding",
+             "fill");
+    out.append(line);
+
+    each([&](const Pool& pool) {
+        Counter cnt  = pool.count();
+        size_t  span = pool.COUNT > 1 ? pool.SPAN : 0;
+        size_t  cap  = cnt.blocks * pool.COUNT; // chunks of blocks in use
+
+        reserved += cnt.generated * span;
+        used     += cnt.chunks * pool.SRC;
+        wasted   += cnt.chunks * pool.padding();
+
+        snprintf(line,
+                 sizeof(line),
+                 "%-12s %7zu %7zu %5zu %4s %6zu/%-8zu %10zu/%-10zu %8zuKiB %8zuKiB %8zuKiB %4zu%%\n",
+                 pool.NAME,
+                 pool.SRC,
+                 pool.CHUNK,
+                 pool.ALIGN,
+                 pool.COUNT <= 1 ? "raw" : (pool.MASK ? "mask" : "head"),
+                 cnt.blocks,
+                 cnt.peak.blocks,
+                 cnt.chunks,
+                 cnt.peak.chunks,
+                 cnt.generated * span / KIB,
+                 cnt.chunks * pool.SRC / KIB,
+                 cnt.chunks * pool.padding() / KIB,
+                 cap ? cnt.chunks * 100 / cap : 0);
+        out.append(line);
+    });
+
+    snprintf(line,
+             sizeof(line),
+             "total: reserved %zuKiB, used %zuKiB, padding %zuKiB\n",
+             reserved / KIB,
+             used / KIB,
+             wasted / KIB);
+    out.append(line);
+    return out;
+}
+
+auto Pool::registry() noexcept -> Registry& {
+    static Registry instance; // outlives static pools, constructed by first one
+    return instance;
+}
+
+bool Pool::owns(const void* in) const noexcept {
+    if(COUNT <= 1) {
+        return in != nullptr;
+    }
+    Block* block = find(in);
+    return block && block->from == this;
+}
+
+template<typename T, typename... Args, typename> T* Pool::allocate(Args&&... args) noexcept {
     if(COUNT <= 1) {
         void* ptr = core::memalloc(SRC, ALIGN);
         if(!ptr) {
@@ -101,8 +308,13 @@ template<typename T, typename... Args> T* Pool::allocate(Args&&... args) noexcep
 
     T* ret = nullptr;
 
+    // take back remote freed chunks before new block
     if(usable.head == nullptr) {
-        generate(); // set new block
+        collect();
+    }
+
+    if(usable.head == nullptr && !generate()) {
+        return nullptr; // bad alloc
     }
 
     ret = static_cast<T*>(usable.head->get());
@@ -136,41 +348,180 @@ template<typename T> bool Pool::deallocate(T* in) noexcept {
     }
 
     // check
-    Block* block = Block::find(in);
+    Block* block = find(in);
+    if(!block || block->from != this) {
+        return false;
+    }
+
+    reclaim(block, in);
+    return true;
+}
+
+template<typename T> size_t Pool::allocate(size_t size, T** out) noexcept {
+    size_t cnt = 0;
+
+    if(COUNT <= 1) {
+        for(; cnt < size; ++cnt) {
+            if(!(out[cnt] = allocate<T>())) {
+                break; // bad alloc
+            }
+        }
+        return cnt;
+    }
+
+    while(cnt < size) {
+        // take back remote freed chunks before new block
+        if(usable.head == nullptr) {
+            collect();
+        }
+
+        if(usable.head == nullptr && !generate()) {
+            break; // bad alloc
+        }
+
+        // whole run of head block
+        cnt += usable.head->get(size - cnt, reinterpret_cast<void**>(out + cnt));
+
+        if(usable.head->empty()) {
+            usable.dequeue();
+        }
+    }
+
+    // call constructor
+    if constexpr(!std::is_void_v<T>) {
+        for(size_t i = 0; i < cnt; ++i) {
+            new(out[i]) T();
+        }
+    }
+
+    counter.chunks += cnt; // count
+    return cnt;
+}
+
+template<typename T> size_t Pool::deallocate(size_t size, T** in) noexcept {
+    size_t cnt = 0;
+
+    if(COUNT <= 1) {
+        for(size_t i = 0; i < size; ++i) {
+            cnt += deallocate<T>(in[i]);
+        }
+        return cnt;
+    }
+
+    size_t i = 0;
+    while(i < size) {
+        Block* block = find(in[i]);
+        if(!block || block->from != this) {
+            ++i;
+            continue; // skip
+        }
+
+        // same block run
+        size_t last = i + 1;
+        while(last < size && find(in[last]) == block) {
+            ++last;
+        }
+
+        // call destructor
+        if constexpr(!std::is_void_v<T>) {
+            for(size_t j = i; j < last; ++j) {
+                in[j]->~T();
+            }
+        }
+
+        reclaim(block, reinterpret_cast<void**>(in + i), last - i);
+        cnt += last - i;
+        i    = last;
+    }
+    return cnt;
+}
+
+template<typename T> bool Pool::defer(T* in) noexcept {
+    if(COUNT <= 1) {
+        return deallocate(in); // no shared state
+    }
+
+    // call destructor
+    if constexpr(!std::is_void_v<T>) {
+        in->~T();
+    }
+
+    // check
+    Block* block = find(in);
     if(!block || block->from != this) {
         return false;
     }
 
+    block->push(in);
+    return true;
+}
+
+size_t Pool::collect() noexcept {
+    if(COUNT <= 1) return 0;
+
+    // fast check, no pending
+    if(pending.load(std::memory_order_relaxed) == nullptr) {
+        return 0;
+    }
+
+    size_t cnt  = 0;
+    Block* iter = pending.exchange(nullptr, std::memory_order_acquire);
+    while(iter) {
+        Block* next  = iter->link; // read before exchange, it can be re-listed after
+        void*  chunk = iter->remote.exchange(nullptr, std::memory_order_acq_rel);
+        while(chunk) {
+            void* temp = *reinterpret_cast<void**>(chunk);
+            reclaim(iter, chunk);
+            chunk = temp;
+            ++cnt;
+        }
+        iter = next;
+    }
+    return cnt;
+}
+
+void Pool::reclaim(Block* block, void* in) noexcept {
+    reclaim(block, &in, 1);
+}
+
+void Pool::reclaim(Block* block, void** in, size_t size) noexcept {
     // empty -> usable
     if(block->empty()) {
         usable.enqueue(block);
     }
 
     // release
-    block->set(in);   // back
-    --counter.chunks; // count
+    for(size_t i = 0; i < size; ++i) {
+        block->set(in[i]); // back
+    }
+    counter.chunks -= size; // count
 
     if(block->full()) {
         if(block != usable.head) {
             usable.pop(block);       // remove
             freeable.enqueue(block); // if head: keep
             --counter.blocks;        // count
+
+            // for decay
+            block->time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count();
         }
     }
-    return true;
 }
 
 bool Pool::generate() noexcept {
     if(COUNT <= 1) return true;
 
     Block* block;
-    if(freeable.head) {
-        block = freeable.dequeue(); // move
+    if(freeable.tail) {
+        block = freeable.tail; // move newest, oldest is for decay
+        freeable.pop(block);
     }
 
     // new
     else {
-        block = static_cast<Block*>(memalloc(META + (CHUNK * COUNT), ALIGN));
+        block = static_cast<Block*>(provider->acquire(SPAN, MASK ? SPAN : ALIGN)); // headerless: aligned to own size
         // check
         if(block) {
             block->initialize(this, COUNT);
@@ -199,16 +550,89 @@ size_t Pool::generate(size_t in) noexcept {
 size_t Pool::release() noexcept {
     if(COUNT <= 1) return 0;
 
+    collect(); // make full blocks freeable
+
     size_t i = 0;
     while(freeable.head != nullptr) {
         Block* ptr = freeable.dequeue();
         all.pop(ptr);
-        memfree(ptr);
+        destroy(ptr);
         counter.generated -= 1;
+        ++i;
     }
     return i;
 }
 
+auto Pool::find(const void* in) const noexcept -> Block* {
+    if(!in) {
+        return nullptr;
+    }
+    if(MASK) {
+        return reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(in) & MASK); // headerless
+    }
+    return Block::find(const_cast<void*>(in));
+}
+
+void Pool::destroy(Block* in) noexcept {
+    provider->release(in, SPAN, MASK ? SPAN : ALIGN); // same as generate
+}
+
+size_t Pool::decay() noexcept {
+    if(COUNT <= 1) return 0;
+
+    collect(); // make full blocks freeable
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+
+    size_t cnt = 0;
+    while(freeable.head != nullptr) {
+        // generated - in use = freeable
+        if(counter.generated - counter.blocks <= policy.retain) {
+            break;
+        }
+
+        // oldest is not expired
+        if(now - freeable.head->time < policy.delay) {
+            break;
+        }
+
+        Block* ptr = freeable.dequeue();
+        all.pop(ptr);
+        destroy(ptr);
+        counter.generated -= 1;
+        ++cnt;
+    }
+    return cnt;
+}
+
+auto Pool::Gauge::operator+=(size_t in) noexcept -> Gauge& {
+    size_t curr = value.load(std::memory_order_relaxed) + in; // single writer
+    value.store(curr, std::memory_order_relaxed);
+    if(curr > peak.load(std::memory_order_relaxed)) {
+        peak.store(curr, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+auto Pool::Gauge::operator-=(size_t in) noexcept -> Gauge& {
+    value.store(value.load(std::memory_order_relaxed) - in, std::memory_order_relaxed); // single writer
+    return *this;
+}
+
+auto Pool::Gauge::operator++() noexcept -> Gauge& {
+    return *this += 1;
+}
+
+auto Pool::Gauge::operator--() noexcept -> Gauge& {
+    return *this -= 1;
+}
+
+Pool::Gauge::operator size_t() const noexcept {
+    return value.load(std::memory_order_relaxed);
+}
+
 void Pool::Queue::enqueue(Block* in) noexcept {
     if(!in) {
         // TODO:
@@ -0,0 +1,151 @@
+#ifndef LWE_MEM_PROVIDER
+#define LWE_MEM_PROVIDER
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../async/lock.hpp"
+#include "../container/linear_buffer.hpp"
+
+/*******************************************************************************
+ * block provider: memory source of pool block
+ *
+ * - Provider: default, aligned malloc / free per block
+ * - Region  : carve blocks from large mapped region (mmap / VirtualAlloc)
+ *
+ * region structure
+ *
+ *  mapped region (default 2 MiB)
+ *  +--------+--------+--------+---- ... ----+--------+------+
+ *  | block  | block  | block  |             |  free  | node |
+ *  +--------+--------+--------+---- ... ----+--------+------+
+ *  ^                          ^                      ^
+ *  begin                      curr (bump)            last
+ *
+ * - block size is adjusted to power of 2, address is aligned to the size.
+ * - released block is kept in free list of same size (log2), not unmapped.
+ * - purge: drop pages of free blocks (MADV_DONTNEED / MEM_RESET), keep mapping.
+ *   purged block is reused after free blocks, without map but with page fault.
+ * - node: region list for unmap, at end of region for block alignment.
+ * - larger than region: use default provider.
+ *
+ * options
+ * - HUGEPAGE: MAP_HUGETLB, fallback madvise(MADV_HUGEPAGE) / MEM_LARGE_PAGES
+ * - PREFAULT: MAP_POPULATE / touch all pages, no page fault on first touch
+ *
+ * container policy
+ * - Source<getter>: container memory from provider, e.g. huge page backed table
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+//! @brief pool block source, default: aligned malloc
+class Provider {
+public:
+    virtual ~Provider() noexcept = default;
+
+public:
+    //! @param [in] size - block size
+    //! @param [in] align - block alignment, power of 2
+    //! @return nullptr: bad alloc
+    virtual void* acquire(size_t size, size_t align) noexcept;
+
+public:
+    //! @param [in] ptr - acquired block
+    //! @param [in] size - same size of acquire
+    //! @param [in] align - same alignment of acquire
+    virtual void release(void* ptr, size_t size, size_t align) noexcept;
+
+public:
+    //! @brief return unused memory to OS, default: nothing to do (free already)
+    //! @return purged block count
+    virtual size_t purge() noexcept;
+
+public:
+    //! @brief default provider instance
+    static Provider* standard() noexcept;
+};
+
+//! @brief carve blocks from large mapped region
+class Region: public Provider {
+public:
+    enum Flag : int {
+        NONE     = 0,
+        HUGEPAGE = 1 << 0, //!< try huge page
+        PREFAULT = 1 << 1, //!< pre-fault all pages on map
+    };
+
+public:
+    static constexpr size_t HUGE_SIZE = 2 << 20; //!< default region, 2 MiB huge page
+    static constexpr size_t PAGE      = 4'096;   //!< smaller block is not purged, shares page
+
+public:
+    //! @param [in] size - region size, adjusted to page size (huge page size when HUGEPAGE)
+    //! @param [in] flag - Flag combination
+    Region(size_t size = HUGE_SIZE, int flag = NONE) noexcept;
+
+public:
+    //! @brief unmap all regions, blocks must be returned
+    ~Region() noexcept override;
+
+public:
+    void*  acquire(size_t, size_t) noexcept override;
+    void   release(void*, size_t, size_t) noexcept override;
+    size_t purge() noexcept override;
+
+public:
+    size_t mapped() const noexcept; //!< @return mapped region count
+
+private:
+    static size_t unitof(size_t, size_t) noexcept; //!< @return block size, power of 2
+
+private:
+    bool  expand() noexcept;             //!< map new region
+    void* map(size_t) noexcept;          //!< OS map
+    void  unmap(void*, size_t) noexcept; //!< OS unmap
+    void  drop(void*, size_t) noexcept;  //!< OS discard pages
+
+private:
+    //! @brief region list node
+    struct Node {
+        Node*  next;
+        void*  base;
+        size_t size;
+    };
+
+    //! @brief free block
+    struct Free {
+        Free* next;
+    };
+
+private:
+    const size_t SIZE; //!< region size
+    const int    FLAG; //!< options
+
+private:
+    async::Lock lock;
+    Node*       regions   = nullptr; //!< mapped list
+    Free*       frees[64] = {};      //!< free list by log2 size
+    uint8_t*    curr      = nullptr; //!< bump pointer
+    uint8_t*    last      = nullptr; //!< bump end (node)
+    size_t      counter   = 0;       //!< mapped count
+
+private:
+    container::LinearBuffer<void*, 1> purged[64]; //!< page dropped blocks by log2 size, no in-place node
+};
+
+//! @brief container allocator policy on provider, see mem/system.hpp
+//! @tparam SOURCE provider getter, e.g. function returning static Region (HUGEPAGE)
+//! @note  size header is added, provider release requires size
+template<Provider* (*SOURCE)()> struct Source {
+    static void* allocate(size_t) noexcept;
+    static void  deallocate(void*) noexcept;
+
+private:
+    static constexpr size_t HEAD = alignof(std::max_align_t); //!< size header, keeps alignment
+};
+
+} // namespace mem
+LWE_END
+#include "provider.ipp"
+#endif
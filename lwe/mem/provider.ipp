@@ -0,0 +1,236 @@
+#if (OS == WINDOWS)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+LWE_BEGIN
+namespace mem {
+
+void* Provider::acquire(size_t size, size_t align) noexcept {
+    return alignalloc(size, align);
+}
+
+void Provider::release(void* in, size_t, size_t) noexcept {
+    alignfree(in);
+}
+
+size_t Provider::purge() noexcept {
+    return 0;
+}
+
+Provider* Provider::standard() noexcept {
+    static Provider instance;
+    return &instance;
+}
+
+Region::Region(size_t size, int flag) noexcept:
+    SIZE{ core::align(size, (flag & HUGEPAGE) ? HUGE_SIZE : config::BLOCK) },
+    FLAG{ flag } { }
+
+Region::~Region() noexcept {
+    while(regions) {
+        Node* next = regions->next; // node is in region
+        unmap(regions->base, regions->size);
+        regions = next;
+    }
+}
+
+size_t Region::unitof(size_t size, size_t align) noexcept {
+    size_t unit = core::align(size > align ? size : align);
+    return unit < sizeof(Free) ? sizeof(Free) : unit;
+}
+
+void* Region::acquire(size_t size, size_t align) noexcept {
+    size_t unit = unitof(size, align);
+    if(unit > SIZE - sizeof(Node)) {
+        return Provider::acquire(size, align); // too large
+    }
+
+    size_t index = core::nlog(unit);
+    LOCKGUARD(lock) {
+        // reuse
+        if(frees[index]) {
+            Free* out    = frees[index];
+            frees[index] = out->next;
+            return out;
+        }
+
+        // reuse purged, page fault on touch
+        void* prev = nullptr;
+        if(purged[index].pop(prev)) {
+            return prev;
+        }
+
+        // bump, aligned to own size
+        uint8_t* out = reinterpret_cast<uint8_t*>(core::align(reinterpret_cast<uintptr_t>(curr), unit));
+        if(!curr || out + unit > last) {
+            if(!expand()) {
+                return nullptr; // bad alloc
+            }
+            out = reinterpret_cast<uint8_t*>(core::align(reinterpret_cast<uintptr_t>(curr), unit));
+            if(out + unit > last) {
+                return nullptr; // unreachable: unit <= SIZE - node
+            }
+        }
+        curr = out + unit;
+        return out;
+    }
+    return nullptr;
+}
+
+void Region::release(void* in, size_t size, size_t align) noexcept {
+    if(!in) {
+        return;
+    }
+
+    // too large, not from region, same unit as acquire
+    size_t unit = unitof(size, align);
+    if(unit > SIZE - sizeof(Node)) {
+        Provider::release(in, size, align);
+        return;
+    }
+
+    size_t index = core::nlog(unit);
+    LOCKGUARD(lock) {
+        Free* node   = static_cast<Free*>(in);
+        node->next   = frees[index];
+        frees[index] = node;
+    }
+}
+
+size_t Region::purge() noexcept {
+    size_t cnt = 0;
+    LOCKGUARD(lock) {
+        for(size_t i = core::nlog(PAGE); i < 64; ++i) {
+            while(frees[i]) {
+                Free* next = frees[i]->next;
+                if(!purged[i].push(static_cast<void*>(frees[i]))) {
+                    break; // bad alloc, keep in free list
+                }
+                drop(frees[i], size_t(1) << i);
+                frees[i] = next;
+                ++cnt;
+            }
+        }
+    }
+    return cnt;
+}
+
+size_t Region::mapped() const noexcept {
+    return counter;
+}
+
+bool Region::expand() noexcept {
+    uint8_t* base = static_cast<uint8_t*>(map(SIZE));
+    if(!base) {
+        return false;
+    }
+
+    // node at end, keep block alignment of begin
+    Node* node = reinterpret_cast<Node*>(base + SIZE - sizeof(Node));
+    node->next = regions;
+    node->base = base;
+    node->size = SIZE;
+
+    regions = node;
+    curr    = base;
+    last    = reinterpret_cast<uint8_t*>(node);
+    ++counter;
+    return true;
+}
+
+void* Region::map(size_t size) noexcept {
+    void* out = nullptr;
+#if (OS == WINDOWS)
+    if(FLAG & HUGEPAGE) {
+        size_t large = GetLargePageMinimum();
+        if(large && size % large == 0) {
+            out = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        }
+    }
+    if(!out) {
+        out = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if(out && (FLAG & PREFAULT)) {
+            volatile uint8_t* page = static_cast<uint8_t*>(out);
+            for(size_t i = 0; i < size; i += config::BLOCK) {
+                page[i] = 0; // touch
+            }
+        }
+    }
+#else
+    int option = MAP_PRIVATE | MAP_ANONYMOUS;
+#    ifdef MAP_POPULATE
+    if(FLAG & PREFAULT) {
+        option |= MAP_POPULATE;
+    }
+#    endif
+#    ifdef MAP_HUGETLB
+    if(FLAG & HUGEPAGE) {
+        out = mmap(nullptr, size, PROT_READ | PROT_WRITE, option | MAP_HUGETLB, -1, 0);
+        if(out == MAP_FAILED) {
+            out = nullptr; // no reserved huge page, fallback
+        }
+    }
+#    endif
+    if(!out) {
+        out = mmap(nullptr, size, PROT_READ | PROT_WRITE, option, -1, 0);
+        if(out == MAP_FAILED) {
+            return nullptr;
+        }
+#    ifdef MADV_HUGEPAGE
+        if(FLAG & HUGEPAGE) {
+            madvise(out, size, MADV_HUGEPAGE); // transparent huge page, hint only
+        }
+#    endif
+#    ifndef MAP_POPULATE
+        if(FLAG & PREFAULT) {
+            volatile uint8_t* page = static_cast<uint8_t*>(out);
+            for(size_t i = 0; i < size; i += config::BLOCK) {
+                page[i] = 0; // touch
+            }
+        }
+#    endif
+    }
+#endif
+    return out;
+}
+
+void Region::drop(void* in, size_t size) noexcept {
+#if (OS == WINDOWS)
+    VirtualAlloc(in, size, MEM_RESET, PAGE_READWRITE);
+#elif defined(MADV_DONTNEED)
+    madvise(in, size, MADV_DONTNEED);
+#endif
+}
+
+void Region::unmap(void* in, size_t size) noexcept {
+#if (OS == WINDOWS)
+    VirtualFree(in, 0, MEM_RELEASE);
+#else
+    munmap(in, size);
+#endif
+}
+
+template<Provider* (*SOURCE)()> void* Source<SOURCE>::allocate(size_t in) noexcept {
+    uint8_t* out = static_cast<uint8_t*>(SOURCE()->acquire(in + HEAD, HEAD));
+    if(!out) {
+        return nullptr;
+    }
+    *reinterpret_cast<size_t*>(out) = in + HEAD;
+    return out + HEAD;
+}
+
+template<Provider* (*SOURCE)()> void Source<SOURCE>::deallocate(void* in) noexcept {
+    if(in) {
+        uint8_t* ptr = static_cast<uint8_t*>(in) - HEAD;
+        SOURCE()->release(ptr, *reinterpret_cast<size_t*>(ptr), HEAD);
+    }
+}
+
+} // namespace mem
+LWE_END
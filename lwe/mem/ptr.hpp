@@ -3,9 +3,8 @@
 
 #include "../base/base.h"
 #include "../mem/block.hpp"
-#include "../util/id.hpp"
 #include "../diag/diag.h"
-#include "pool.hpp"
+#include "allocator.hpp"
 
 /**************************************************************************************************
  * Ptr<T>: unique_ptr + weak_ptr hybrid smart pointer
@@ -18,47 +17,127 @@
  * - Perform copy-on-write with `clone()` method.
  *
  * Use case: lightweight smart pointer for memory safety with minimal overhead.
+ *
+ **************************************************************************************************
+ * Slotmap<T>: generational slot map, Ptr<T> is a handle (8 bytes)
+ *
+ *  handle: [ index 32 | generation 32 ]
+ *             |
+ *             v
+ *  pages:  [ page ][ page ][ null ] ...      << fixed directory, page is never moved
+ *             |
+ *             v
+ *  slot:   [ generation | dense | data | owner | deleter ]
+ *                           |
+ *                           v
+ *  dense:  [ data, slot ][ data, slot ] ...  << live instances only, swap remove
+ *
+ * - valid  : slot generation == handle generation, released slot increments generation.
+ * - get    : slot data, nullptr when dangling.
+ * - release: call deleter, generation + 1, slot to free list (index reuse).
+ * - each   : iterate dense array, no hole.
+ * - internal data is allocated from Allocator<T>, deleter destroys and frees it.
+ *
+ * NOTE: generation 0 is never used, null handle is { 0, 0 }.
+ * NOTE: pages and dense array are never freed, static Ptr can be released on exit.
+ * NOTE: acquire / release / each are locked, handle access is not (Ptr is thread unsafe).
  **************************************************************************************************/
 
 LWE_BEGIN
 namespace mem {
-//! @brief a non-releasable memory pool dedicated to `Ptr`
-template<typename T> class Slotmap {
-    using Adapter = Slotmap<mem::Block<sizeof(T)>>;
-public:
-    static T*   acquire();
-    static void release(T* in);
-};
 
-template<typename T> class Ptr {
+//! @brief generational slot map of Ptr<T> control data
+template<typename T> class Slotmap: Static {
+public:
     using Deleter = void (*)(T*); //!< custom destructor
 
-    //! constrcutor SFINAE for incomplete type
-    template<typename U, typename... Args> using Enable = std::enable_if_t<std::is_constructible_v<U, Args...>>;
-
-    //! block base
-    struct Block {
-        uint64_t id    = 0;
-        Ptr*     owner = nullptr;
+public:
+    //! @brief 8 byte handle
+    struct Handle {
+        uint32_t index;
+        uint32_t generation; //!< 0: null
     };
 
-    //! internal data control block
-    struct Internal: Block {
-        ~Internal() { /* not work */ }
-        union {
-            T       data;
-            uint8_t ptr[sizeof(T)] = { 0 }; // memset
-        };
+private:
+    //! @brief control data
+    struct Slot {
+        uint32_t generation; //!< current generation, 0: not used
+        uint32_t dense;      //!< dense index, next free index when released
+        T*       data;       //!< object
+        void*    owner;      //!< owner Ptr
+        Deleter  deleter;    //!< destructor, nullptr: nothing
     };
 
-    //! external data control block
-    struct External: Block {
-        T* ptr = nullptr;
+    //! @brief live instance
+    struct Dense {
+        T*       data;
+        uint32_t slot;
     };
 
 private:
-    bool initialize(bool); // malloc
-    bool release();        // free
+    static constexpr uint32_t SHIFT     = 12;           //!< log2(page)
+    static constexpr uint32_t PAGE      = 1 << SHIFT;   //!< slots per page
+    static constexpr uint32_t DIRECTORY = 1 << 12;      //!< page count, max slot: 16M
+    static constexpr uint32_t NONE      = ~uint32_t(0); //!< end of free list
+
+public:
+    //! @return null handle: bad alloc
+    static Handle acquire(T*, Deleter, void* owner) noexcept;
+
+public:
+    //! @brief call deleter and invalidate all handles of slot
+    //! @return false: invalid handle
+    static bool release(const Handle&);
+
+public:
+    //! @brief batch, lock once @return acquired count
+    static size_t acquire(size_t, T* const*, Deleter, Handle*) noexcept;
+
+public:
+    //! @brief batch, lock once, deleters are called after unlock @return released count
+    static size_t release(size_t, const Handle*);
+
+public:
+    static bool   valid(const Handle&) noexcept;        //!< check null and dangling
+    static T*     get(const Handle&) noexcept;          //!< @return nullptr: null or dangling
+    static void*  owner(const Handle&) noexcept;        //!< @return nullptr: null or dangling
+    static bool   owner(const Handle&, void*) noexcept; //!< set owner @return false: null or dangling
+    static size_t size() noexcept;                      //!< live instance count
+
+public:
+    //! @brief visit live instances, F: void(T*)
+    template<typename F> static void each(F&&);
+
+private:
+    static Slot* slot(uint32_t) noexcept;   //!< nullptr: page is not allocated
+    static Slot* expand() noexcept;         //!< new slot from high-water mark, nullptr: full
+    static bool  reserve() noexcept;        //!< dense array grow
+    static void  remove(uint32_t) noexcept; //!< free slot, generation + 1
+
+private:
+    inline static async::Lock lock;
+    inline static Slot*       pages[DIRECTORY] = {};
+    inline static Dense*      dense            = nullptr;
+    inline static uint32_t    count            = 0;    //!< dense size, live instance count
+    inline static uint32_t    capacity         = 0;    //!< dense capacity
+    inline static uint32_t    top              = 0;    //!< slot high-water mark
+    inline static uint32_t    vacant           = NONE; //!< free slot list
+};
+
+template<typename T> class Ptr {
+    using Slotmap = mem::Slotmap<T>;
+    using Handle  = typename Slotmap::Handle;
+    using Deleter = typename Slotmap::Deleter;
+
+    //! constrcutor SFINAE for incomplete type
+    template<typename U, typename... Args> using Enable = std::enable_if_t<std::is_constructible_v<U, Args...>>;
+
+private:
+    bool initialize(T*, Deleter); // acquire handle
+    bool release();               // free when owner
+
+private:
+    static void destroy(T*); // internal data deleter
 
 public:
     //! default set nullptr
@@ -95,8 +174,8 @@ public:
 public:
     bool operator==(void*) const;      //!< compare to pointer
     bool operator!=(void*) const;      //!< compare to pointer
-    bool operator==(const Ptr&) const; //!< compare if the block are the same
-    bool operator!=(const Ptr&) const; //!< compare if the block are the same
+    bool operator==(const Ptr&) const; //!< compare if the handle are the same
+    bool operator!=(const Ptr&) const; //!< compare if the handle are the same
 
 public:
     explicit operator bool() const;     //! check nullptr
@@ -105,12 +184,12 @@ public:
 
 public:
     //! @brief to unique, NEED: copy constructor
-    //! @return false: bad alloc
+    //! @return false: bad alloc or dangling
     bool clone();
 
 public:
-    T*       get();       //!< get
-    const T* get() const; //!< get
+    T*       get();       //!< get, nullptr: null or dangling
+    const T* get() const; //!< get, nullptr: null or dangling
 
 public:
     template<typename U> U*       as();       //!< cast
@@ -122,10 +201,7 @@ public:
     bool valid() const; //!< check null and dangling
 
 private:
-    Block*   block;   //!< block
-    Deleter  deleter; //!< custom deleter
-    uint64_t id = 0;  //!< dangling checker
-    bool     pointer; //!< is pointer flag
+    Handle handle; //!< slot index and generation
 };
 
 } // namespace mem
@@ -1,123 +1,269 @@
 LWE_BEGIN
 namespace mem {
 
-//! specailizated pool for same-sized types
-template<size_t N> class Slotmap<Block<N>> {
-    static async::Lock lock;
-    static Pool        pool;
-public:
-    static void* acquire();
-    static void  release(void* in);
-};
-template<size_t N> async::Lock Slotmap<Block<N>>::lock;
-template<size_t N> Pool        Slotmap<Block<N>>::pool{ N };
+template<typename T> auto Slotmap<T>::slot(uint32_t in) noexcept -> Slot* {
+    Slot* page = pages[in >> SHIFT];
+    if(!page) {
+        return nullptr;
+    }
+    return page + (in & (PAGE - 1));
+}
 
-template<typename T> T* Slotmap<T>::acquire() {
-    return static_cast<T*>(Adapter::acquire());
+template<typename T> auto Slotmap<T>::expand() noexcept -> Slot* {
+    if(top == PAGE * DIRECTORY) {
+        return nullptr; // full
+    }
+
+    // new page
+    Slot*& page = pages[top >> SHIFT];
+    if(!page) {
+        page = static_cast<Slot*>(std::calloc(PAGE, sizeof(Slot))); // generation 0
+        if(!page) {
+            return nullptr;
+        }
+    }
+    return page + (top++ & (PAGE - 1));
 }
 
-template<typename T> void Slotmap<T>::release(T* in) {
-    Adapter::release(static_cast<void*>(in));
+template<typename T> bool Slotmap<T>::reserve() noexcept {
+    if(count < capacity) {
+        return true;
+    }
+
+    uint32_t cap   = capacity ? capacity << 1 : PAGE;
+    Dense*   newly = static_cast<Dense*>(std::realloc(dense, sizeof(Dense) * cap));
+    if(!newly) {
+        return false;
+    }
+    dense    = newly;
+    capacity = cap;
+    return true;
 }
 
-template<size_t N> void* Slotmap<Block<N>>::acquire() {
-    LOCKGUARD(lock) return pool.allocate();
+template<typename T> void Slotmap<T>::remove(uint32_t in) noexcept {
+    Slot* target = slot(in);
+
+    // swap remove, update moved slot
+    Dense& last = dense[--count];
+    slot(last.slot)->dense = target->dense;
+    dense[target->dense]   = last;
+
+    // invalidate handles, skip 0
+    if(++target->generation == 0) {
+        target->generation = 1;
+    }
+
+    target->data    = nullptr;
+    target->owner   = nullptr;
+    target->deleter = nullptr;
+    target->dense   = vacant; // free list
+    vacant          = in;
 }
 
-template<size_t N> void Slotmap<Block<N>>::release(void* in) {
-    LOCKGUARD(lock) pool.deallocate(in);
+template<typename T> auto Slotmap<T>::acquire(T* data, Deleter deleter, void* owner) noexcept -> Handle {
+    Handle out = { 0, 0 };
+    if(acquire(1, &data, deleter, &out)) {
+        slot(out.index)->owner = owner; // not shared yet
+    }
+    return out;
 }
 
-template<typename T> bool Ptr<T>::initialize(bool flag) {
-    pointer = flag;
-    id      = 0;
+template<typename T>
+size_t Slotmap<T>::acquire(size_t size, T* const* data, Deleter deleter, Handle* out) noexcept {
+    size_t cnt = 0;
+    LOCKGUARD(lock) {
+        for(; cnt < size; ++cnt) {
+            uint32_t index;
+            Slot*    target;
+
+            // reuse released slot
+            if(vacant != NONE) {
+                index  = vacant;
+                target = slot(index);
+                vacant = target->dense;
+            }
 
-    // arg == ptr, store external
-    if(flag) {
-        block = Slotmap<External>::acquire();
-        // acquire failed
-        if(!block) {
-            return false;
+            // new slot
+            else {
+                index  = top;
+                target = expand();
+                if(!target) {
+                    break; // full or bad alloc
+                }
+                target->generation = 1;
+            }
+
+            if(!reserve()) {
+                target->dense = vacant; // rollback
+                vacant        = index;
+                break;
+            }
+
+            dense[count]    = Dense{ data[cnt], index };
+            target->dense   = count++;
+            target->data    = data[cnt];
+            target->owner   = nullptr;
+            target->deleter = deleter;
+
+            out[cnt] = Handle{ index, target->generation };
         }
     }
+    return cnt;
+}
+
+template<typename T> bool Slotmap<T>::release(const Handle& in) {
+    return release(1, &in) != 0;
+}
+
+template<typename T> size_t Slotmap<T>::release(size_t size, const Handle* in) {
+    struct Detached {
+        T*      data;
+        Deleter deleter;
+    };
+    static constexpr size_t CHUNK = 64; //!< stack list size
+
+    // detached list: stack, or heap for a large batch, bad alloc: lock once per chunk
+    Detached  local[CHUNK];
+    Detached* list = size > CHUNK ? static_cast<Detached*>(std::malloc(sizeof(Detached) * size)) : nullptr;
+    size_t    step = list ? size : CHUNK;
+    if(!list) {
+        list = local;
+    }
 
-    // arg != ptr, store internal
-    else {
-        block = Slotmap<Internal>::acquire();
-        // acquire failed
-        if(!block) {
-            return false;
+    size_t cnt = 0;
+    for(size_t begin = 0; begin < size; begin += step) {
+        size_t end = size - begin < step ? size : begin + step;
+        size_t n   = 0;
+
+        // detach under lock
+        LOCKGUARD(lock) {
+            for(size_t i = begin; i < end; ++i) {
+                if(valid(in[i])) {
+                    Slot* target = slot(in[i].index);
+                    list[n++]    = Detached{ target->data, target->deleter };
+                    remove(in[i].index);
+                }
+            }
         }
+        cnt += n;
+
+        // destroy out of lock, deleter can release other Ptr
+        for(size_t i = 0; i < n; ++i) {
+            if(list[i].deleter) {
+                list[i].deleter(list[i].data);
+            }
+        }
+    }
+
+    if(list != local) {
+        std::free(list);
     }
+    return cnt;
+}
 
-    // succeded
-    id = util::ID<Ptr<T>>().value(); // get id
+template<typename T> bool Slotmap<T>::valid(const Handle& in) noexcept {
+    const Slot* target = slot(in.index);
+    return target && target->generation == in.generation; // generation 0 is never in slot
+}
 
-    block->id    = id;   // set block id
-    block->owner = this; // set owner
-    return true;
+template<typename T> T* Slotmap<T>::get(const Handle& in) noexcept {
+    const Slot* target = slot(in.index);
+    if(target && target->generation == in.generation) {
+        return target->data;
+    }
+    return nullptr;
+}
+
+template<typename T> void* Slotmap<T>::owner(const Handle& in) noexcept {
+    const Slot* target = slot(in.index);
+    if(target && target->generation == in.generation) {
+        return target->owner;
+    }
+    return nullptr;
+}
+
+template<typename T> bool Slotmap<T>::owner(const Handle& in, void* owner) noexcept {
+    Slot* target = slot(in.index);
+    if(target && target->generation == in.generation) {
+        target->owner = owner;
+        return true;
+    }
+    return false;
+}
+
+template<typename T> size_t Slotmap<T>::size() noexcept {
+    return count;
+}
+
+template<typename T> template<typename F> void Slotmap<T>::each(F&& fn) {
+    LOCKGUARD(lock) {
+        for(uint32_t i = 0; i < count; ++i) {
+            fn(dense[i].data);
+        }
+    }
+}
+
+template<typename T> bool Ptr<T>::initialize(T* data, Deleter deleter) {
+    handle = Slotmap::acquire(data, deleter, this);
+    return handle.generation != 0;
 }
 
 template<typename T> bool Ptr<T>::release() {
-    if(!block) {
+    if(!handle.generation) {
         return false;
     }
 
     // call destructor
-    if(block->owner == this) {
-        block->id = 0; // defeasance
-        if(pointer) {
-            // if external call deleter(ptr);
-            if(deleter) {
-                deleter(get());
-            }
-            Slotmap<External>::release(reinterpret_cast<External*>(block)); // free
-        }
-        else {
-            // else call dtor only
-            get()->~T();
-            Slotmap<Internal>::release(reinterpret_cast<Internal*>(block)); // free
-        }
+    if(Slotmap::owner(handle) == this) {
+        Slotmap::release(handle);
     }
 
-    id      = 0;
-    block   = nullptr; // for safe
-    deleter = nullptr; // for safe
+    handle = Handle{ 0, 0 }; // for safe
     return true;
 }
 
+template<typename T> void Ptr<T>::destroy(T* in) {
+    Allocator<T, alignof(T)>::deallocate(in); // call dtor and free
+}
+
 // default: set nullptr
-template<typename T> Ptr<T>::Ptr(): block(nullptr), deleter(nullptr), id(0), pointer(true) { }
+template<typename T> Ptr<T>::Ptr(): handle{ 0, 0 } { }
 
 // pointer
-template<typename T> Ptr<T>::Ptr(T* in, Deleter func): block(nullptr), deleter(nullptr), id(0), pointer(true) {
+template<typename T> Ptr<T>::Ptr(T* in, Deleter func): handle{ 0, 0 } {
     if(in == nullptr) {
         return;
     }
-    deleter = func; // for safe
 
-    if(!initialize(true)) {
+    if(!initialize(in, func)) {
         throw diag::error(diag::Code::BAD_ALLOC); // init failed
     }
-    reinterpret_cast<External*>(block)->ptr = in; // set
 }
 
 // reference
 template<typename T>
-template<typename U, typename> Ptr<T>::Ptr(const U& in): deleter(nullptr) {
-    if(!initialize(false)) {
+template<typename U, typename> Ptr<T>::Ptr(const U& in): handle{ 0, 0 } {
+    T* data = Allocator<T, alignof(T)>::allocate(in); // copy
+    if(!data) {
+        throw diag::error(diag::Code::BAD_ALLOC);
+    }
+    if(!initialize(data, &destroy)) {
+        destroy(data);
         throw diag::error(diag::Code::BAD_ALLOC); // init failed
     }
-    new(reinterpret_cast<Internal*>(block)->ptr) T(in); // copy
 }
 
 // move
 template<typename T>
-template<typename U, typename> Ptr<T>::Ptr(U&& in): deleter(nullptr) {
-    if(!initialize(false)) {
+template<typename U, typename> Ptr<T>::Ptr(U&& in): handle{ 0, 0 } {
+    T* data = Allocator<T, alignof(T)>::allocate(std::move(in)); // move
+    if(!data) {
+        throw diag::error(diag::Code::BAD_ALLOC);
+    }
+    if(!initialize(data, &destroy)) {
+        destroy(data);
         throw diag::error(diag::Code::BAD_ALLOC); // init failed
     }
-    new(reinterpret_cast<Internal*>(block)->ptr) T(std::move(in)); // move
 }
 
 // dtor
@@ -126,22 +272,14 @@ template<typename T> Ptr<T>::~Ptr() {
 }
 
 // copy
-template<typename T> Ptr<T>::Ptr(const Ptr& in):
-    block(in.block),
-    deleter(in.deleter),
-    id(in.id),
-    pointer(in.pointer) { }
+template<typename T> Ptr<T>::Ptr(const Ptr& in): handle(in.handle) { }
 
 // move
-template<typename T> Ptr<T>::Ptr(Ptr&& in) noexcept:
-    block(in.block),
-    deleter(in.deleter),
-    id(in.id),
-    pointer(in.pointer) {
+template<typename T> Ptr<T>::Ptr(Ptr&& in) noexcept: handle(in.handle) {
     // move
-    in.block = nullptr;
-    if(block && block->owner == &in) {
-        block->owner = this;
+    in.handle = Handle{ 0, 0 };
+    if(Slotmap::owner(handle) == &in) {
+        Slotmap::owner(handle, this);
     }
 }
 
@@ -150,14 +288,9 @@ template<typename T> auto Ptr<T>::operator=(const Ptr& in) -> Ptr& {
     if(this == &in) return *this;
 
     // reset
-    if(block) {
-        release();
-    }
+    release();
 
-    block   = in.block;
-    deleter = in.deleter;
-    id      = in.id;
-    pointer = in.pointer;
+    handle = in.handle;
     return *this;
 }
 
@@ -166,47 +299,40 @@ template<typename T> auto Ptr<T>::operator=(Ptr&& in) noexcept -> Ptr& {
     if(this == &in) return *this;
 
     // reset
-    if(block) {
-        release();
-    }
+    release();
 
     // move
-    block   = in.block;
-    deleter = in.deleter;
-    id      = in.id;
-    pointer = in.pointer;
+    handle    = in.handle;
+    in.handle = Handle{ 0, 0 };
 
-    // move
-    in.block = nullptr;
-
-    // block not null
-    if(block && block->owner == &in) {
-        block->owner = this;
+    // handle not null
+    if(Slotmap::owner(handle) == &in) {
+        Slotmap::owner(handle, this);
     }
     return *this;
 }
 
 // getter: ptr
 template<typename T> T* Ptr<T>::operator->() {
-    if(valid()) return get();
+    if(T* out = get()) return out;
     throw diag::error(diag::INVALID_DATA);
 }
 
 // const getter: ptr
 template<typename T> const T* Ptr<T>::operator->() const {
-    if(valid()) return get();
+    if(const T* out = get()) return out;
     throw diag::error(diag::INVALID_DATA);
 }
 
 // getter: ref
 template<typename T> T& Ptr<T>::operator*() {
-    if(valid()) return *get();
+    if(T* out = get()) return *out;
     throw diag::error(diag::INVALID_DATA);
 }
 
 // const getter: ref
 template<typename T> const T& Ptr<T>::operator*() const {
-    if(valid()) return *get();
+    if(const T* out = get()) return *out;
     throw diag::error(diag::INVALID_DATA);
 }
 
@@ -219,7 +345,7 @@ template<typename T> bool Ptr<T>::operator!=(void* in) const {
 }
 
 template<typename T> bool Ptr<T>::operator==(const Ptr& in) const {
-    return block == in.block;
+    return handle.index == in.handle.index && handle.generation == in.handle.generation;
 }
 
 template<typename T> bool Ptr<T>::operator!=(const Ptr& in) const {
@@ -240,38 +366,38 @@ template<typename T> Ptr<T>::operator const T*() const {
 
 template<typename T> bool Ptr<T>::clone() {
     // not failed
-    if(!block) {
+    if(!handle.generation) {
         return true;
     }
 
     // is owner
-    if(block->owner == this) {
+    if(Slotmap::owner(handle) == this) {
         return true;
     }
 
     T* data = get(); // pre-get
+    if(!data) {
+        return false; // dangling
+    }
 
-    if(!initialize(false)) {
+    // deep copy by copy constructor
+    T* copy = Allocator<T, alignof(T)>::allocate(*data);
+    if(!copy) {
+        return false; // failed
+    }
+    if(!initialize(copy, &destroy)) {
+        destroy(copy);
         return false; // failed
     }
-
-    // deep copy by placement new copy constructor
-    new(get()) T(*data);
     return true;
 }
 
 template<typename T> T* Ptr<T>::get() {
-    if(!block) {
-        return nullptr;
-    }
-    if(pointer) {
-        return reinterpret_cast<External*>(block)->ptr;
-    }
-    else return &reinterpret_cast<Internal*>(block)->data;
+    return Slotmap::get(handle);
 }
 
 template<typename T> const T* Ptr<T>::get() const {
-    return const_cast<Ptr*>(this)->get();
+    return Slotmap::get(handle);
 }
 
 template<typename T> template<typename U> U* Ptr<T>::as() {
@@ -283,25 +409,15 @@ template<typename T> template<typename U> const U* Ptr<T>::as() const {
 }
 
 template<typename T> bool Ptr<T>::owned() const {
-    if(block) {
-        return block->owner == this; // same
-    }
-    return false;
+    return handle.generation && Slotmap::owner(handle) == this;
 }
 
 template<typename T> bool Ptr<T>::own() {
-    if(valid()) {
-        block->owner = this;
-        return true;
-    }
-    return false;
+    return Slotmap::owner(handle, this);
 }
 
 template<typename T> bool Ptr<T>::valid() const {
-    if(block && id) {
-        return id == block->id; // same and not 0
-    }
-    return false; // invalid
+    return Slotmap::valid(handle);
 }
 
 } // namespace mem
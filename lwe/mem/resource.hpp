@@ -0,0 +1,120 @@
+#ifndef LWE_MEM_RESOURCE
+#define LWE_MEM_RESOURCE
+
+#include <memory_resource>
+
+#include "../base/base.h"
+#include "../config/config.h"
+#include "../async/lock.hpp"
+#include "allocator.hpp"
+#include "arena.hpp"
+#include "heap.hpp"
+
+/*******************************************************************************
+ * std::pmr::memory_resource adapters
+ *
+ *  std::pmr::vector<T>(&resource)
+ *    |
+ *    +-> HeapResource    : any size, Heap size classes + thread cache
+ *    |     +-> align > 16: std::pmr::new_delete_resource()
+ *    |
+ *    +-> PoolResource    : own Pool, size <= chunk, locked
+ *    |     +-> else      : upstream (default HeapResource)
+ *    |
+ *    +-> BlockResource<N>: shared Allocator<Block<N>> pool + thread cache
+ *    |     +-> else      : HeapResource
+ *    |
+ *    +-> ArenaResource   : Arena bump, deallocate is nothing
+ *
+ * - bad alloc throws diag::error(BAD_ALLOC), memory_resource contract.
+ * - size and alignment of deallocate select the same route as allocate.
+ * - HeapResource and BlockResource<N> are stateless, all instances compare equal.
+ *
+ * e.g.
+ *  mem::PoolResource               nodes(sizeof(Node));
+ *  std::pmr::unordered_map<int, T> table(&nodes);
+ *
+ * NOTE: ArenaResource is not thread safe, same as Arena.
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+//! @brief general size resource, mem::Heap
+class HeapResource: public std::pmr::memory_resource {
+public:
+    static constexpr size_t ALIGN = 16; //!< max alignment from Heap, else new_delete_resource
+
+public:
+    //! @brief shared instance
+    static HeapResource* instance() noexcept;
+
+protected:
+    void* do_allocate(size_t, size_t) override;
+    void  do_deallocate(void*, size_t, size_t) override;
+    bool  do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+};
+
+//! @brief fixed size resource, owns pool
+class PoolResource: public std::pmr::memory_resource {
+public:
+    //! @param [in] chunk - max size from pool, larger goes upstream
+    //! @param [in] alignment - chunk alignment, larger goes upstream
+    //! @param [in] upstream - fallback, default nullptr -> HeapResource::instance()
+    PoolResource(size_t                     chunk,
+                 size_t                     alignment = alignof(std::max_align_t),
+                 std::pmr::memory_resource* upstream  = nullptr) noexcept;
+
+public:
+    PoolResource(const PoolResource&)            = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+public:
+    size_t release() noexcept; //!< @return freed block count
+    size_t decay() noexcept;   //!< @return released count by policy
+
+protected:
+    void* do_allocate(size_t, size_t) override;
+    void  do_deallocate(void*, size_t, size_t) override;
+    bool  do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+private:
+    bool fit(size_t, size_t) const noexcept; //!< pool route
+
+private:
+    const size_t               CHUNK;    //!< pool chunk size
+    const size_t               ALIGN;    //!< pool chunk alignment
+    std::pmr::memory_resource* upstream; //!< fallback
+    Pool                       pool;
+    async::Lock                lock;
+};
+
+//! @brief fixed size resource, Allocator<Block<N>, ALIGN> static pool
+template<size_t N, size_t ALIGN = alignof(std::max_align_t)> class BlockResource: public std::pmr::memory_resource {
+    using Adapter = Allocator<Block<N>, ALIGN>;
+
+protected:
+    void* do_allocate(size_t, size_t) override;
+    void  do_deallocate(void*, size_t, size_t) override;
+    bool  do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+};
+
+//! @brief monotonic resource, Arena
+class ArenaResource: public std::pmr::memory_resource {
+public:
+    //! @param [in] arena - not owned, deallocate is nothing, free by Arena::reset / rewind
+    ArenaResource(Arena&) noexcept;
+
+protected:
+    void* do_allocate(size_t, size_t) override;
+    void  do_deallocate(void*, size_t, size_t) override;
+    bool  do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+private:
+    Arena& arena;
+};
+
+} // namespace mem
+LWE_END
+#include "resource.ipp"
+#endif
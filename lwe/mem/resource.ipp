@@ -0,0 +1,144 @@
+LWE_BEGIN
+namespace mem {
+
+/*
+ * heap
+ */
+
+HeapResource* HeapResource::instance() noexcept {
+    static HeapResource statics;
+    return &statics;
+}
+
+void* HeapResource::do_allocate(size_t size, size_t alignment) {
+    if(alignment > ALIGN) {
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    // small class is aligned to pointer size only
+    void* out = Heap::allocate(alignment > sizeof(void*) && size < ALIGN ? ALIGN : size);
+    if(!out) {
+        throw diag::error(diag::Code::BAD_ALLOC);
+    }
+    return out;
+}
+
+void HeapResource::do_deallocate(void* in, size_t size, size_t alignment) {
+    if(alignment > ALIGN) {
+        std::pmr::new_delete_resource()->deallocate(in, size, alignment);
+    }
+    else Heap::deallocate(in);
+}
+
+bool HeapResource::do_is_equal(const std::pmr::memory_resource& in) const noexcept {
+    return dynamic_cast<const HeapResource*>(&in) != nullptr; // stateless
+}
+
+/*
+ * pool
+ */
+
+PoolResource::PoolResource(size_t chunk, size_t alignment, std::pmr::memory_resource* upstream) noexcept:
+    CHUNK{ chunk },
+    ALIGN{ alignment <= sizeof(void*) ? sizeof(void*) : core::align(alignment) },
+    upstream{ upstream ? upstream : HeapResource::instance() },
+    pool(chunk, ALIGN, 0, config::HEADERLESS, nullptr, "Resource") { }
+
+bool PoolResource::fit(size_t size, size_t alignment) const noexcept {
+    return size <= CHUNK && alignment <= ALIGN;
+}
+
+void* PoolResource::do_allocate(size_t size, size_t alignment) {
+    if(!fit(size, alignment)) {
+        return upstream->allocate(size, alignment);
+    }
+
+    void* out = nullptr;
+    LOCKGUARD(lock) {
+        out = pool.allocate<void>();
+    }
+    if(!out) {
+        throw diag::error(diag::Code::BAD_ALLOC);
+    }
+    return out;
+}
+
+void PoolResource::do_deallocate(void* in, size_t size, size_t alignment) {
+    if(!fit(size, alignment)) {
+        upstream->deallocate(in, size, alignment);
+    }
+    else pool.defer(in); // lock-free, collected by allocate
+}
+
+bool PoolResource::do_is_equal(const std::pmr::memory_resource& in) const noexcept {
+    return this == &in;
+}
+
+size_t PoolResource::release() noexcept {
+    size_t cnt = 0;
+    LOCKGUARD(lock) {
+        cnt = pool.release();
+    }
+    return cnt;
+}
+
+size_t PoolResource::decay() noexcept {
+    size_t cnt = 0;
+    LOCKGUARD(lock) {
+        cnt = pool.decay();
+    }
+    return cnt;
+}
+
+/*
+ * block
+ */
+
+template<size_t N, size_t ALIGN> void* BlockResource<N, ALIGN>::do_allocate(size_t size, size_t alignment) {
+    if(size > N || alignment > ALIGN) {
+        return HeapResource::instance()->allocate(size, alignment);
+    }
+
+    void* out = Adapter::allocate();
+    if(!out) {
+        throw diag::error(diag::Code::BAD_ALLOC);
+    }
+    return out;
+}
+
+template<size_t N, size_t ALIGN> void BlockResource<N, ALIGN>::do_deallocate(void* in, size_t size, size_t alignment) {
+    if(size > N || alignment > ALIGN) {
+        HeapResource::instance()->deallocate(in, size, alignment);
+    }
+    else Adapter::deallocate(in);
+}
+
+template<size_t N, size_t ALIGN>
+bool BlockResource<N, ALIGN>::do_is_equal(const std::pmr::memory_resource& in) const noexcept {
+    return dynamic_cast<const BlockResource*>(&in) != nullptr; // stateless
+}
+
+/*
+ * arena
+ */
+
+ArenaResource::ArenaResource(Arena& arena) noexcept: arena(arena) { }
+
+void* ArenaResource::do_allocate(size_t size, size_t alignment) {
+    void* out = arena.allocate(size, alignment);
+    if(!out) {
+        throw diag::error(diag::Code::BAD_ALLOC);
+    }
+    return out;
+}
+
+void ArenaResource::do_deallocate(void*, size_t, size_t) {
+    // nothing
+}
+
+bool ArenaResource::do_is_equal(const std::pmr::memory_resource& in) const noexcept {
+    return this == &in;
+}
+
+} // namespace mem
+LWE_END
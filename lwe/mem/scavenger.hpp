@@ -0,0 +1,69 @@
+#ifndef LWE_MEM_SCAVENGER
+#define LWE_MEM_SCAVENGER
+
+#include <condition_variable>
+#include <vector>
+
+#include "../base/base.h"
+#include "../config/config.h"
+
+/*******************************************************************************
+ * background memory scavenger
+ *
+ *  scavenger thread
+ *    |
+ *    +-> every interval: call all tasks
+ *          e.g. Allocator<T>::decay, Heap::decay, Region::purge
+ *
+ * - task returns released count, run() returns the sum.
+ * - task must take own lock, it is called on scavenger thread.
+ *
+ * e.g.
+ *  mem::Scavenger scavenger;
+ *  scavenger.push(&mem::Heap::decay);
+ *  scavenger.push([&region]() { return region.purge(); });
+ *  scavenger.start();
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+class Scavenger {
+    using Task = std::function<size_t()>;
+
+public:
+    //! @param [in] interval - ms, default config::DECAY
+    Scavenger(size_t interval = config::DECAY);
+
+public:
+    //! @brief stop and join
+    ~Scavenger();
+
+public:
+    void push(Task); //!< add task, thread safe
+
+public:
+    size_t run(); //!< call all tasks once on caller thread, @return released count
+
+public:
+    void start(); //!< start background thread
+    void stop();  //!< stop and join
+
+private:
+    void loop(); //!< scavenger thread work
+
+private:
+    const size_t INTERVAL; //!< ms
+
+private:
+    std::vector<Task>       tasks;   //!< registered tasks
+    std::thread             thread;  //!< scavenger thread
+    std::condition_variable event;   //!< stop wake condition
+    std::mutex              mtx;     //!< tasks and flag mutex
+    bool                    running; //!< thread running flag
+};
+
+} // namespace mem
+LWE_END
+#include "scavenger.ipp"
+#endif
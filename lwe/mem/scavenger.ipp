@@ -0,0 +1,60 @@
+LWE_BEGIN
+namespace mem {
+
+Scavenger::Scavenger(size_t interval): INTERVAL(interval ? interval : 1), running(false) { }
+
+Scavenger::~Scavenger() {
+    stop();
+}
+
+void Scavenger::push(Task in) {
+    LOCKGUARD(mtx) {
+        tasks.push_back(std::move(in));
+    }
+}
+
+size_t Scavenger::run() {
+    size_t cnt = 0;
+    LOCKGUARD(mtx) {
+        for(auto& task : tasks) {
+            cnt += task();
+        }
+    }
+    return cnt;
+}
+
+void Scavenger::start() {
+    LOCKGUARD(mtx) {
+        if(running) {
+            return; // already
+        }
+        running = true;
+    }
+    thread = std::thread([this]() { loop(); });
+}
+
+void Scavenger::stop() {
+    LOCKGUARD(mtx) {
+        running = false;
+    }
+    event.notify_all(); // wake up
+    if(thread.joinable()) {
+        thread.join();
+    }
+}
+
+void Scavenger::loop() {
+    std::unique_lock guard(mtx);
+    while(running) {
+        // sleep interval, stop wakes up
+        if(event.wait_for(guard, std::chrono::milliseconds(INTERVAL), [this]() { return !running; })) {
+            break;
+        }
+        for(auto& task : tasks) {
+            task();
+        }
+    }
+}
+
+} // namespace mem
+LWE_END
@@ -0,0 +1,47 @@
+#ifndef LWE_MEM_SYSTEM
+#define LWE_MEM_SYSTEM
+
+#include "../base/base.h"
+
+/*******************************************************************************
+ * container allocator policy
+ *
+ * stateless, static functions only
+ *  - static void* allocate(size_t bytes) noexcept: nullptr is bad alloc
+ *  - static void  deallocate(void*) noexcept     : nullptr is ignored
+ * optional
+ *  - static void* reallocate(void*, size_t) noexcept: nullptr is bad alloc, input is kept
+ *    relocatable elements grow in place or by one copy of bytes (see core::Relocatable)
+ *
+ * policies
+ *  - System   : std::malloc / std::free, default
+ *  - Frame    : per-frame arena, free is nothing (mem/arena.hpp)
+ *  - Heap     : size-class pools with thread cache (mem/heap.hpp)
+ *  - Source<F>: any Provider, e.g. huge page Region (mem/provider.hpp)
+ *
+ * std::pmr containers use memory_resource adapters instead (mem/resource.hpp)
+ *
+ * e.g.
+ *  container::LinearBuffer<int, 0, mem::Frame> scratch; // per frame
+ *  stl::Map<String, int, mem::Heap>             table;   // pooled buckets and chains
+ ******************************************************************************/
+
+LWE_BEGIN
+namespace mem {
+
+//! @brief default container allocator, std::malloc / std::free
+struct System {
+    static void* allocate(size_t) noexcept;
+    static void  deallocate(void*) noexcept;
+    static void* reallocate(void*, size_t) noexcept; //!< std::realloc
+};
+
+//! @brief check optional reallocate of allocator policy
+template<typename A, typename = void> struct Resizable: std::false_type { };
+template<typename A>
+struct Resizable<A, std::void_t<decltype(A::reallocate(static_cast<void*>(nullptr), size_t{}))>>: std::true_type { };
+
+} // namespace mem
+LWE_END
+#include "system.ipp"
+#endif
@@ -0,0 +1,17 @@
+LWE_BEGIN
+namespace mem {
+
+void* System::allocate(size_t in) noexcept {
+    return std::malloc(in);
+}
+
+void System::deallocate(void* in) noexcept {
+    std::free(in);
+}
+
+void* System::reallocate(void* in, size_t size) noexcept {
+    return std::realloc(in, size);
+}
+
+} // namespace mem
+LWE_END
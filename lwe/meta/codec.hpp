@@ -13,6 +13,10 @@ template<typename T>
 struct TypeError;
 
 LWE_BEGIN
+namespace async {
+class Worker; //!< bulk build pool, see async/worker.hpp, included by stl/set, map, flat_map
+} // namespace async
+
 namespace meta {
 
 class Object;
@@ -30,6 +34,11 @@ public:
     static String encode(const Object&);             //!< Object encoder
     static void   decode(Object*, const StringView); //!< Object decoder
 
+public:
+    //! @brief live instances encoder, e.g. "[ { ... }, { ... } ]"
+    //! @param [in] derived - true: instances of derived classes too
+    static String encode(const Class*, bool = false);
+
 public:
     template<typename T, typename U> static String encode(const std::pair<T, U>&);             //!< pair encode
     template<typename T, typename U> static void   decode(std::pair<T, U>*, const StringView); //!< pair decode
@@ -42,6 +51,12 @@ private:
     template<typename T> static void from(String*, const void*);  // run-time encode helper
     template<typename T> static void to(void*, const StringView); // run-time decode helper
 
+private:
+    //! @brief shared bulk build pool, hash container decode
+    //! @param [in] count: element count
+    //! @return nullptr: small, or single core
+    template<typename W = async::Worker> static W* worker(size_t);
+
 public:
     template<typename T> static const char* map(T);                // enum to string
     template<typename T> static T           map(const StringView); // string to enum
@@ -258,6 +273,12 @@ template<typename T> void Codec::decode(Container* ptr, StringView in) {
     }
     T& out = *reinterpret_cast<T*>(ptr); // else
 
+    // hash container and flat map: collect all, then bulk build (size or sort once, parallel fill)
+    constexpr bool HASHED = TypeEraser<T>::KEYWORD == Keyword::STL_SET || TypeEraser<T>::KEYWORD == Keyword::STL_MAP ||
+                            TypeEraser<T>::KEYWORD == Keyword::STL_FLATMAP;
+    struct None { };
+    std::conditional_t<HASHED, std::vector<typename T::value_type>, None> bulk; // collected, HASHED only
+
     Decoder decoder(in);
     decoder.move(2); // ignore `[ `
     while(true) {
@@ -266,7 +287,10 @@ template<typename T> void Codec::decode(Container* ptr, StringView in) {
         // deserialize
         typename T::value_type data;
         data = to<typename T::value_type>(decoder.get()); // auto
-        out.push(std::move(data));
+        if constexpr(HASHED) {
+            bulk.push_back(std::move(data));
+        }
+        else out.push(std::move(data));
 
         // move 2 reason
         // ing -> `, `
@@ -278,6 +302,20 @@ template<typename T> void Codec::decode(Container* ptr, StringView in) {
             break;
         }
     }
+
+    if constexpr(HASHED) {
+        if(!out.build(bulk.data(), bulk.size(), worker(bulk.size()))) {
+            throw diag::error(diag::BAD_ALLOC);
+        }
+    }
+}
+
+template<typename W> W* Codec::worker(size_t count) {
+    if(count < config::PARALLELBUILD || std::thread::hardware_concurrency() < 2) {
+        return nullptr; // not worth
+    }
+    static W pool(std::thread::hardware_concurrency() - 1); // + caller thread
+    return &pool;
 }
 
 /**************************************************************************************************
@@ -304,6 +342,29 @@ String Codec::encode(const Object& in) {
     return buffer;
 }
 
+// serialize: live instances in memory order
+String Codec::encode(const Class* in, bool derived) {
+    if(!in) {
+        return "[]";
+    }
+
+    String buffer;
+    buffer.reserve(4'096);
+    buffer.append("[ ");
+    size_t cnt = in->each(
+        [&buffer](const Object* obj) {
+            buffer.append(encode(*obj));
+            buffer.append(", ");
+        },
+        derived);
+
+    if(cnt == 0) {
+        return "[]";
+    }
+    buffer.replace(buffer.size() - 2, 2, " ]"); // last ", "
+    return buffer;
+}
+
 // deserialize
 void Codec::decode(Object* out, StringView in) {
     // empty
@@ -479,11 +540,14 @@ void Codec::encode(std::string* out, const void* in, Keyword type) {
             // out->append(static_cast<const EInterface*>(in)->stringify());
             break;
 
-        case Keyword::STD_STRING: from<String>(out, in); break;
-        case Keyword::STL_STACK:  from<Encoder>(out, in); break;
-        case Keyword::STL_DEQUE:  from<Encoder>(out, in); break;
-        case Keyword::STL_MAP:    from<Encoder>(out, in); break;
-        case Keyword::STL_SET:    from<Encoder>(out, in); break;
+        case Keyword::STD_STRING:  from<String>(out, in); break;
+        case Keyword::STL_STACK:   from<Encoder>(out, in); break;
+        case Keyword::STL_DEQUE:   from<Encoder>(out, in); break;
+        case Keyword::STL_MAP:     from<Encoder>(out, in); break;
+        case Keyword::STL_SET:     from<Encoder>(out, in); break;
+        case Keyword::STL_TREESET: from<Encoder>(out, in); break;
+        case Keyword::STL_TREEMAP: from<Encoder>(out, in); break;
+        case Keyword::STL_FLATMAP: from<Encoder>(out, in); break;
 
         case Keyword::UNREGISTERED:
         case Keyword::VOID:         break;
@@ -524,11 +588,14 @@ void Codec::decode(void* out, const StringView in, Keyword type) {
             // static_cast<EInterface*>(out)->parse(in);
             break;
 
-        case Keyword::STD_STRING: *static_cast<String*>(out) = to<String>(in); break;
-        case Keyword::STL_STACK:  static_cast<Encoder*>(out)->deserialize(in); break;
-        case Keyword::STL_DEQUE:  static_cast<Encoder*>(out)->deserialize(in); break;
-        case Keyword::STL_MAP:    static_cast<Encoder*>(out)->deserialize(in); break;
-        case Keyword::STL_SET:    static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STD_STRING:  *static_cast<String*>(out) = to<String>(in); break;
+        case Keyword::STL_STACK:   static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STL_DEQUE:   static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STL_MAP:     static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STL_SET:     static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STL_TREESET: static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STL_TREEMAP: static_cast<Encoder*>(out)->deserialize(in); break;
+        case Keyword::STL_FLATMAP: static_cast<Encoder*>(out)->deserialize(in); break;
 
         case Keyword::UNREGISTERED:
         case Keyword::VOID:         break;
@@ -37,17 +37,33 @@ enum class Keyword : uint8_t {
     STL_DEQUE,
     STL_SET,
     STL_MAP,
+    STL_TREESET,
+    STL_TREEMAP,
+    STL_FLATMAP,
     STL_ANY,
     CONST,
 };
 
 constexpr bool storable(Keyword in) {
     switch(in) {
-        case lwe::meta::Keyword::STL_STACK: return true;
-        case lwe::meta::Keyword::STL_DEQUE: return true;
-        case lwe::meta::Keyword::STL_SET:   return true;
-        case lwe::meta::Keyword::STL_MAP:   return true;
-        default:                            return false;
+        case lwe::meta::Keyword::STL_STACK:   return true;
+        case lwe::meta::Keyword::STL_DEQUE:   return true;
+        case lwe::meta::Keyword::STL_SET:     return true;
+        case lwe::meta::Keyword::STL_MAP:     return true;
+        case lwe::meta::Keyword::STL_TREESET: return true;
+        case lwe::meta::Keyword::STL_TREEMAP: return true;
+        case lwe::meta::Keyword::STL_FLATMAP: return true;
+        default:                              return false;
+    }
+}
+
+//! @brief key-value container, key and value types follow the keyword
+constexpr bool mapped(Keyword in) {
+    switch(in) {
+        case lwe::meta::Keyword::STL_MAP:     return true;
+        case lwe::meta::Keyword::STL_TREEMAP: return true;
+        case lwe::meta::Keyword::STL_FLATMAP: return true;
+        default:                              return false;
     }
 }
 
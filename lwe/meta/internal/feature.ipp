@@ -64,6 +64,9 @@ constexpr const char* typestring(Keyword code) {
     case Keyword::STL_DEQUE:          return "Deque";
     case Keyword::STL_SET:            return "Set";
     case Keyword::STL_MAP:            return "Map";
+    case Keyword::STL_TREESET:        return "TreeSet";
+    case Keyword::STL_TREEMAP:        return "TreeMap";
+    case Keyword::STL_FLATMAP:        return "FlatMap";
     case Keyword::STD_PAIR:           return "Pair";
     case Keyword::CONST:              return "const";
     case Keyword::ENUM:               return "enum";
@@ -20,6 +20,7 @@ public:
     template<typename U> RC(const RC<U>&);
     template<typename U> RC(RC<U>&&);
     RC(std::nullptr_t);
+    RC(const Class*); //!< factory by metaclass, e.g. RC<Object>(classof("Name"))
     ~RC();
 
 public:
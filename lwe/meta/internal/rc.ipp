@@ -7,6 +7,17 @@ template<typename T> RC<T>::RC():
         [](Object* in) { Object::destructor(static_cast<Object*>(in)); }) // custom deallocator
 { }
 
+// ctor: metaclass, allocate from cached class pool
+template<typename T> RC<T>::RC(const Class* in):
+    ptr(Object::constructor(in),                   // class pool
+        [](Object* in) { Object::destructor(in); }) // virtual destructor
+{
+    // check failed, ptr releases instance
+    if(ptr.valid() && !ptr->template isof<T>()) {
+        throw diag::error(diag::Code::TYPE_MISMATCH);
+    }
+}
+
 // copy: shallow
 template<typename T> RC<T>::RC(const RC& in): ptr(in.ptr) { }
 
@@ -128,7 +128,12 @@ template<typename T> const Reflector<T>& Reflector<T>::find(const String& in) {
 }
 
 template<typename T> const Reflector<T>& Reflector<T>::find(const char* in) {
-    return find(String{ in });
+    Table& table  = map();
+    auto   result = table.find(in); // no string copy when registered
+    if(result != table.end()) {
+        return result->second;
+    }
+    return table[String{ in }];
 }
 
 template<typename T> template<typename Arg> void Reflector<T>::push(Arg&& in) {
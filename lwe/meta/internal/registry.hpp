@@ -23,12 +23,17 @@ public:
     ~Registry();
     template<typename U> static void add(const String&);  //!< @tparam U base of T
     template<typename U> static void add(const char*);    //!< @tparam U base of T
-    static T*                        find(const String&); //!< find, compare string, no string_view
-    static T*                        find(const char*);   //!< find, compare string, no string_view
+    static T*                        find(const String&); //!< find by name
+    static T*                        find(const char*);   //!< find by name, no string copy
+    static T*                        find(StringView);    //!< find by name, no string copy
+    template<typename F> static void each(F&&);           //!< visit all, F: void(T*)
 
 private:
     Table table;
 
+private:
+    template<typename Q> static T* lookup(const Q&); //!< transparent find
+
 private:
     static Table& instance();
 };
@@ -1,10 +1,18 @@
 LWE_BEGIN
 namespace meta {
-template<typename T> T* Registry<T>::find(const char* in) { 
-    return find(String{ in });
+template<typename T> T* Registry<T>::find(const char* in) {
+    return lookup(in);
 }
 
 template<typename T> T* Registry<T>::find(const String& in) {
+    return lookup(in);
+}
+
+template<typename T> T* Registry<T>::find(StringView in) {
+    return lookup(in);
+}
+
+template<typename T> template<typename Q> T* Registry<T>::lookup(const Q& in) {
     auto result = instance().find(in);
     if(result != instance().end()) {
         return result->second;
@@ -23,6 +31,12 @@ template<typename T> template<typename U> void Registry<T>::add(const String& in
     }
 }
 
+template<typename T> template<typename F> void Registry<T>::each(F&& fn) {
+    for(auto& it : instance()) {
+        fn(it.second);
+    }
+}
+
 template<typename T> Registry<T>::~Registry() {
     for(auto& it : table) {
         delete it.second;
@@ -78,6 +78,9 @@ public:
     static Method* find(const String& cls, const char* name);
     static Method* find(const String& cls, const String& name);
 
+private:
+    template<typename C, typename N> static Method* lookup(const C&, const N&); //!< transparent find
+
 private:
     Table table;
 
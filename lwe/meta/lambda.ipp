@@ -31,19 +31,28 @@ void Registry<Method>::add(const String& cls, const String& name, Method* lambda
 }
 
 Method* Registry<Method>::find(const char* cls, const char* name) {
-    return find(String{ cls }, String{ name });
+    return lookup(cls, name);
 }
 
 Method* Registry<Method>::find(const char* cls, const String& name) {
-    return find(String{ cls }, name);
+    return lookup(cls, name);
 }
 
 Method* Registry<Method>::find(const String& cls, const char* name) {
-    return find(cls, String{ name });
+    return lookup(cls, name);
 }
 
 Method* Registry<Method>::find(const String& cls, const String& name) {
-    auto& table  = instance()[cls];
+    return lookup(cls, name);
+}
+
+template<typename C, typename N> Method* Registry<Method>::lookup(const C& cls, const N& name) {
+    auto& outer = instance();
+    auto  found = outer.find(cls);
+    if(found == outer.end()) {
+        return nullptr; // no method of class
+    }
+    auto& table  = found->second;
     auto  result = table.find(name);
     if(result != table.end()) {
         return result->second;
@@ -42,17 +42,8 @@ public:
     bool                      isof(const String&) const; //!< check same type of derived by name
 
 private:
-    struct Pool {
-        ~Pool() {
-            for(auto& p : map) delete p.second;
-        }
-        std::unordered_map<size_t, mem::Pool*> map;
-    };
-    static std::unordered_map<size_t, mem::Pool*>& pool() {
-        static std::unordered_map<size_t, mem::Pool*> instance;
-        return instance;
-    }
-    static async::Lock lock;
+    //! @brief allocate from Class::pool(), lock per class
+    static void* allocate(const Class*);
 };
 
 //! @brief Object metadata, has not base -> manual generation
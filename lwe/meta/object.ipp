@@ -5,8 +5,6 @@ namespace meta {
 // clang-format off
 // for serialize
 
-async::Lock Object::lock;
-
 // feauter.ipp implementation
 template<typename T> Registered registclass() {
    // default, other class -> template specialization
@@ -106,25 +104,26 @@ Registered Object_REGISTERED = registclass<Object>();
  * etc
  */
 
+// pool is cached in metaclass: no lookup, no global lock
+void* Object::allocate(const Class* in) {
+    mem::Pool* pool = in->pool();
+    if(!pool) {
+        return nullptr;
+    }
+
+    void* ptr = nullptr;
+    LOCKGUARD(in->lock) {
+        ptr = pool->allocate<void>();
+    }
+    return ptr;
+}
+
 // use metaclass
 Object* Object::constructor(const Class* in) {
-    void* ptr = nullptr;
-    LOCKGUARD(Object::lock) {
-        // get size
-        size_t size = in->size();
-
-        // size to hash: if same size, use the same pool.
-        auto result = Object::pool().find(size);
-        // find pool
-        if (result == Object::pool().end()) {
-            // generate pool
-            Object::pool()[size] = new mem::Pool(size);
-            // refind
-            result = Object::pool().find(size);
-        }
-        // allocate
-        ptr = result->second->allocate<void>();
+    if(!in) {
+        return nullptr;
     }
+    void* ptr = allocate(in);
 
     // allocate succeeded -> call constructor virtual
     if(ptr) {
@@ -139,23 +138,7 @@ template<typename T> T* Object::constructor() {
         return nullptr;
     }
 
-    void* ptr = nullptr;
-    LOCKGUARD(Object::lock) {
-        // get size
-        size_t size = classof<T>()->size();
-
-        // size to hash: if same size, use the same pool.
-        auto result = Object::pool().find(size);
-        // find pool
-        if(result == Object::pool().end()) {
-            // generate pool
-            Object::pool()[size] = new mem::Pool(size);
-            // refind
-            result = Object::pool().find(size);
-        }
-        // allocate
-        ptr = result->second->allocate<void>();
-    }
+    void* ptr = allocate(classof<T>());
 
     // allocate succeeded -> call constructor T
     if(ptr) {
@@ -173,14 +156,12 @@ void Object::destructor(Object* in) {
         return;
     }
 
-    // get size to find pool
-    size_t size = in->meta()->size();
+    // get pool before destruct
+    mem::Pool* pool = in->meta()->pool();
     in->~Object();
 
-    LOCKGUARD(Object::lock) {
-        // size to hash, and find
-        Object::pool()[size]->deallocate<void>(in);
-    }
+    // lock free, owner collects on allocate
+    pool->defer<void>(in);
 }
 
 // template
@@ -195,15 +176,12 @@ template<typename T> void Object::destructor(T* in) {
         return;
     }
 
-    // get size to find pool
-    size_t size = in->meta()->size();
+    // get pool before destruct
+    mem::Pool* pool = in->meta()->pool();
     in->~T();
 
-    // lock
-    LOCKGUARD(Object::lock) {
-        // size to hash, and find
-        Object::pool()[size]->deallocate<void>(in);
-    }
+    // lock free, owner collects on allocate
+    pool->defer<void>(in);
 }
 
 }
@@ -3,6 +3,7 @@
 
 #include "internal/feature.hpp"
 #include "../util/hash.hpp"
+#include "../mem/pool.hpp"
 
 LWE_BEGIN
 namespace meta {
@@ -115,6 +116,23 @@ struct Class {
 public:
     const Field& field(const char*) const;   //!< get filed
     const Field& field(const String&) const; //!< get filed
+
+public:
+    //! @brief dedicated instance pool, created on first use
+    //! @return nullptr: bad alloc
+    mem::Pool* pool() const;
+
+public:
+    //! @brief visit live instances from pool() in memory order, F: void(Object*)
+    //! @param [in] derived - true: visit derived classes after, class by class
+    //! @note  F must not create instance of visited class, destroy is fine
+    //! @return visited count
+    template<typename F> size_t each(F&&, bool derived = false) const;
+
+private:
+    friend class Object;
+    mutable std::atomic<mem::Pool*> instances = nullptr; //!< cached pool, no lookup
+    mutable async::Lock             lock;                //!< instance pool owner lock
 };
 
 //! @brief enum metadata
@@ -94,7 +94,7 @@ template<typename T> static void Type::reflect(Type* out) {
     else if constexpr(TypeEraser<T>::KEYWORD != Keyword::UNREGISTERED) {
         out->push(TypeEraser<T>::KEYWORD);
         // map
-        if constexpr(TypeEraser<T>::KEYWORD == Keyword::STL_MAP) {
+        if constexpr(mapped(TypeEraser<T>::KEYWORD)) {
             reflect<typename T::value_type::first_type>(out);
             reflect<typename T::value_type::second_type>(out);
         }
@@ -403,7 +403,7 @@ size_t Type::stringify(String* out, const Type& in, size_t idx) {
         size_t last = next;
 
         // map
-        if(in[idx] == Keyword::STL_MAP) {
+        if(mapped(in[idx])) {
             out->append(", ");
             last = stringify(out, in, next);
         }
@@ -424,6 +424,45 @@ size_t Type::stringify(String* out, const Type& in, size_t idx) {
     return idx + 1;
 }
 
+mem::Pool* Class::pool() const {
+    mem::Pool* out = instances.load(std::memory_order_acquire);
+    if(out) {
+        return out;
+    }
+
+    LOCKGUARD(lock) {
+        out = instances.load(std::memory_order_relaxed);
+        if(!out) {
+            out = new(std::nothrow) mem::Pool(size(), 0, 0, config::HEADERLESS, nullptr, name());
+            instances.store(out, std::memory_order_release);
+        }
+    }
+    return out;
+}
+
+template<typename F> size_t Class::each(F&& fn, bool derived) const {
+    size_t cnt = 0;
+
+    // not created: no instance
+    if(mem::Pool* pool = instances.load(std::memory_order_acquire)) {
+        LOCKGUARD(lock) {
+            cnt += pool->live([&fn](void* in) { fn(static_cast<Object*>(in)); });
+        }
+    }
+
+    if(derived) {
+        Registry<Class>::each([&](Class* in) {
+            for(const Class* iter = in->base(); iter; iter = iter->base()) {
+                if(iter == this) {
+                    cnt += in->each(fn, false);
+                    break;
+                }
+            }
+        });
+    }
+    return cnt;
+}
+
 const Field& Class::field(const char* name) const {
     return field(String{ name });
 }
@@ -7,8 +7,8 @@
 LWE_BEGIN
 namespace stl {
 
-DECLARE_CONTAINER((typename T, size_t SVO = 0), Deque, LWE::container::RingBuffer, T, SVO);
-REGISTER_CONTAINER((typename T, size_t SVO), Deque, Keyword::STL_DEQUE, T, SVO);
+DECLARE_CONTAINER((typename T, size_t SVO = 0, typename A = LWE::mem::System), Deque, LWE::container::RingBuffer, T, SVO, A);
+REGISTER_CONTAINER((typename T, size_t SVO, typename A), Deque, Keyword::STL_DEQUE, T, SVO, A);
 
 } // namespace stl
 LWE_END
@@ -0,0 +1,17 @@
+#ifndef LWE_STL_FLAT_MAP
+#define LWE_STL_FLAT_MAP
+
+#include "../meta/meta.h"
+#include "../async/worker.hpp" // Codec bulk build pool
+#include "../container/flat_table.hpp"
+
+LWE_BEGIN
+namespace stl {
+
+//! @brief ordered map, sorted array for read-mostly data
+DECLARE_CONTAINER((typename K, typename V, typename A = LWE::mem::System), FlatMap, LWE::container::FlatTable, K, V, A);
+REGISTER_CONTAINER((typename K, typename V, typename A), FlatMap, Keyword::STL_FLATMAP, K, V, A);
+
+} // namespace stl
+LWE_END
+#endif
@@ -2,13 +2,15 @@
 #define LWE_STL_MAP
 
 #include "../meta/meta.h"
-#include "../container/hash_table.hpp"
+#include "../async/worker.hpp" // Codec bulk build pool
+#include "../container/hash_backend.hpp"
 
 LWE_BEGIN
 namespace stl {
 
-DECLARE_CONTAINER((typename K, typename V), Map, LWE::container::HashTable, K, V);
-REGISTER_CONTAINER((typename K, typename V), Map, Keyword::STL_MAP, K, V);
+//! @tparam B backend, container::Chaining, container::Probing or container::Ordered
+DECLARE_CONTAINER((typename K, typename V, typename A = LWE::mem::System, typename B = LWE::container::Chaining), Map, LWE::container::HashMap, K, V, A, B);
+REGISTER_CONTAINER((typename K, typename V, typename A, typename B), Map, Keyword::STL_MAP, K, V, A, B);
 
 } // namespace stl
 LWE_END
@@ -2,13 +2,15 @@
 #define LWE_STL_SET
 
 #include "../meta/meta.h"
-#include "../container/hashed_buffer.hpp"
+#include "../async/worker.hpp" // Codec bulk build pool
+#include "../container/hash_backend.hpp"
 
 LWE_BEGIN
 namespace stl {
 
-DECLARE_CONTAINER((typename T), Set, LWE::container::HashedBuffer, T);
-REGISTER_CONTAINER((typename T), Set, Keyword::TL_SET, T);
+//! @tparam B backend, container::Chaining, container::Probing or container::Ordered
+DECLARE_CONTAINER((typename T, typename A = LWE::mem::System, typename B = LWE::container::Chaining), Set, LWE::container::HashSet, T, A, B);
+REGISTER_CONTAINER((typename T, typename A, typename B), Set, Keyword::STL_SET, T, A, B);
 
 } // namespace stl
 LWE_END
@@ -7,8 +7,8 @@
 LWE_BEGIN
 namespace stl {
 
-DECLARE_CONTAINER((typename T, size_t SVO = 0), Stack, LWE::container::LinearBuffer, T, SVO);
-REGISTER_CONTAINER((typename T, size_t SVO), Stack, Keyword::STL_STACK, T, SVO);
+DECLARE_CONTAINER((typename T, size_t SVO = 0, typename A = LWE::mem::System), Stack, LWE::container::LinearBuffer, T, SVO, A);
+REGISTER_CONTAINER((typename T, size_t SVO, typename A), Stack, Keyword::STL_STACK, T, SVO, A);
 
 } // namespace stl
 LWE_END
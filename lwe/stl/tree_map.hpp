@@ -0,0 +1,17 @@
+#ifndef LWE_STL_TREE_MAP
+#define LWE_STL_TREE_MAP
+
+#include "../meta/meta.h"
+#include "../container/tree_table.hpp"
+
+LWE_BEGIN
+namespace stl {
+
+//! @brief ordered map, B+tree with pooled nodes by default
+//! @tparam A container::Pooled or allocator policy, see mem/system.hpp
+DECLARE_CONTAINER((typename K, typename V, typename A = LWE::container::Pooled), TreeMap, LWE::container::TreeTable, K, V, A);
+REGISTER_CONTAINER((typename K, typename V, typename A), TreeMap, Keyword::STL_TREEMAP, K, V, A);
+
+} // namespace stl
+LWE_END
+#endif
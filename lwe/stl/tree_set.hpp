@@ -0,0 +1,17 @@
+#ifndef LWE_STL_TREE_SET
+#define LWE_STL_TREE_SET
+
+#include "../meta/meta.h"
+#include "../container/tree_buffer.hpp"
+
+LWE_BEGIN
+namespace stl {
+
+//! @brief ordered set, B+tree with pooled nodes by default
+//! @tparam A container::Pooled or allocator policy, see mem/system.hpp
+DECLARE_CONTAINER((typename T, typename A = LWE::container::Pooled), TreeSet, LWE::container::TreeSet, T, A);
+REGISTER_CONTAINER((typename T, typename A), TreeSet, Keyword::STL_TREESET, T, A);
+
+} // namespace stl
+LWE_END
+#endif
@@ -16,6 +16,24 @@ template<size_t N> struct Buffer {
     char buffer[N - sizeof(n)] = { 0 };
 };
 
+// non-trivial element, move takes the heap pointer, R: core::Relocatable
+template<size_t N, bool R> struct Owner {
+    Owner(int n = 0): n(n) { }
+    Owner(Owner&& in) noexcept: n(in.n), heap(in.heap) { in.heap = nullptr; }
+    Owner& operator=(Owner&& in) noexcept { return n = in.n, std::swap(heap, in.heap), *this; }
+    ~Owner() { delete[] heap; }
+
+    int   n;
+    char* heap = nullptr;
+    char  buffer[N - sizeof(n) - sizeof(heap)];
+};
+
+LWE_BEGIN
+namespace core {
+template<size_t N> struct Relocatable<Owner<N, true>>: std::true_type { };
+} // namespace core
+LWE_END
+
 static constexpr size_t SIZE  = 128;
 static constexpr size_t COUNT = 5'000'000;
 
@@ -60,6 +78,36 @@ int main() {
 
     std::cout << std::endl;
 
+    /***********************************************************************************************
+     * PUSH BACK TEST (NON-TRIVIAL, GROWTH: MOVE AND DESTROY EACH / REALLOC, HEAD IS 0)
+     ***********************************************************************************************/
+
+    Bench own_push, move_push, reloc_push;
+    for(int i = 0; i < Bench::TRY; ++i) {
+        std::deque<Owner<SIZE, true>>  owndeq;
+        RingBuffer<Owner<SIZE, false>> movedeq;
+        RingBuffer<Owner<SIZE, true>>  relocdeq;
+
+        own_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) owndeq.emplace_back(i); // push
+            dummy = owndeq.size();                                 // read
+        });
+        move_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) movedeq.push_back(Owner<SIZE, false>(i)); // push
+            dummy = movedeq.size();                                                  // read
+        });
+        reloc_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) relocdeq.push_back(Owner<SIZE, true>(i)); // push
+            dummy = relocdeq.size();                                                 // read
+        });
+    }
+
+    own_push.output("STD PUSH BACK (NON-TRIVIAL)");
+    move_push.output("LWE PUSH BACK (NON-TRIVIAL, MOVE)");
+    move_push.from(own_push.average());
+    reloc_push.output("LWE PUSH BACK (NON-TRIVIAL, RELOCATABLE)");
+    reloc_push.from(move_push.average()); // gain of relocation
+
     /***********************************************************************************************
      * PUSH POP PRE
      ***********************************************************************************************/
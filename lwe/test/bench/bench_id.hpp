@@ -0,0 +1,67 @@
+#include "internal/bench.hpp"
+
+#include "../../util/id.hpp"
+#include <vector>
+#include <thread>
+
+static constexpr int      COUNT   = 1'000'000; // per thread
+static constexpr unsigned THREADS = 32;        // max thread count
+
+struct Tag { }; // ID<Tag> counter
+
+// old scheme: one shared counter, fetch_add per id
+uint64_t shared() {
+    static std::atomic<uint64_t> id = 1;
+    return id.fetch_add(1, std::memory_order_relaxed);
+}
+
+// generate on each thread, join all
+template<typename Gen> void run(unsigned threads, Gen gen) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for(unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            volatile uint64_t dummy = 0;
+            for(int i = 0; i < COUNT; ++i) dummy = gen();
+        });
+    }
+    for(auto& worker : workers) worker.join();
+}
+
+// million ids per second
+void throughput(const char* name, unsigned threads, float sec) {
+    double ops = double(threads) * COUNT;
+    printf("%s THROUGHPUT: %.2f Mids/s\n", name, sec > 0 ? ops / sec / 1'000'000 : 0.0);
+}
+
+int main() {
+    Bench::introduce();
+
+    std::cout << "ID COUNT:     " << COUNT << " PER THREAD\n"
+              << "ID RANGE:     " << lwe::config::IDRANGE << "\n"
+              << "THREAD LIMIT: " << THREADS << "\n";
+    std::cout << std::endl;
+
+    // warm-up
+    run(THREADS, []() { return shared(); });
+    run(THREADS, []() { return lwe::util::ID<Tag>().value(); });
+
+    for(unsigned n = 1; n <= THREADS; n <<= 1) {
+        Bench global, ranged;
+
+        for(int i = 0; i < Bench::TRY; ++i) {
+            global.once([&]() { run(n, []() { return shared(); }); });
+            ranged.once([&]() { run(n, []() { return lwe::util::ID<Tag>().value(); }); });
+        }
+
+        global.output("SHARED COUNTER THREADS: ", n);
+        ranged.output("THREAD RANGE THREADS: ", n);
+
+        Bench::line(false);
+        throughput("SHARED", n, global.average());
+        throughput("RANGED", n, ranged.average());
+
+        std::cout << "THREAD RANGE PERFORMANCE COMPARED TO SHARED COUNTER\n";
+        ranged.from(global.average());
+    }
+}
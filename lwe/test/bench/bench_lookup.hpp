@@ -0,0 +1,72 @@
+#include "internal/bench.hpp"
+
+#include "../../stl/map.hpp"
+#include "../../util/random.hpp"
+#include <string>
+#include <vector>
+
+static constexpr int SIZE  = 8'000'000; // table size, far beyond LLC
+static constexpr int COUNT = 4'000'000; // lookup count, half hit
+
+// string keys: hashing is not free, single lookups stall on the bucket load
+using Map = lwe::stl::Map<lwe::String, int>;
+
+lwe::String key(int in) {
+    return "key:" + std::to_string(in);
+}
+
+// million lookups per second
+void throughput(const char* name, float sec) {
+    printf("%s THROUGHPUT: %.2f Mlookups/s\n", name, sec > 0 ? COUNT / sec / 1'000'000 : 0.0);
+}
+
+int main() {
+    Bench::introduce();
+
+    Map map;
+    map.reserve(SIZE);
+    for(int i = 0; i < SIZE; ++i) map.push(key(i << 1), i); // even keys
+
+    // random keys over even (hit) and odd (miss)
+    std::vector<lwe::String> keys(COUNT);
+    for(int i = 0; i < COUNT; ++i) keys[i] = key(lwe::util::Random::generate(0, (SIZE << 1) - 1));
+
+    std::cout << "TABLE SIZE:    " << SIZE << " (" << map.capacity() << " BUCKETS)\n"
+              << "LOOKUP COUNT:  " << COUNT << "\n";
+    std::cout << std::endl;
+
+    std::vector<Map::iterator> out(COUNT, map.end());
+    volatile size_t            dummy = 0;
+
+    Bench single, batched;
+
+    // find
+    single.loop([&]() {
+        for(int i = 0; i < COUNT; ++i) out[i] = map.find(keys[i]);
+    });
+    batched.loop([&]() { map.find_many(keys.data(), COUNT, out.data()); });
+
+    single.output("FIND");
+    batched.output("FIND MANY");
+    Bench::line(false);
+    throughput("FIND     ", single.average());
+    throughput("FIND MANY", batched.average());
+    std::cout << "BATCHED PERFORMANCE COMPARED TO SINGLE\n";
+    batched.from(single.average());
+
+    // exist
+    single.loop([&]() {
+        size_t found = 0;
+        for(int i = 0; i < COUNT; ++i) found += map.exist(keys[i]);
+        dummy = found;
+    });
+    batched.loop([&]() { dummy = map.exist_many(keys.data(), COUNT); });
+
+    single.output("EXIST");
+    batched.output("EXIST MANY");
+    Bench::line(false);
+    throughput("EXIST     ", single.average());
+    throughput("EXIST MANY", batched.average());
+    std::cout << "BATCHED PERFORMANCE COMPARED TO SINGLE\n";
+    batched.from(single.average());
+}
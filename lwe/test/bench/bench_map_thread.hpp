@@ -0,0 +1,148 @@
+#include "internal/bench.hpp"
+
+#include "../../stl/map.hpp"
+#include "../../container/concurrent_hash_table.hpp"
+#include <vector>
+#include <thread>
+
+static constexpr int COUNT = 200'000; // operations per thread
+static constexpr int KEYS  = 65'536; // key range
+
+using Map        = lwe::stl::Map<int, int>;
+using Concurrent = lwe::container::ConcurrentHashTable<int, int>;
+
+// old path: map + mutex
+struct Locked {
+    Map        map;
+    std::mutex mtx;
+
+    void write(int key, int value) {
+        LOCKGUARD(mtx) {
+            auto it = map.find(key);
+            if(it == map.end()) map.push(key, value);
+            else it->second = value;
+        }
+    }
+
+    bool read(int key, int& out) {
+        LOCKGUARD(mtx) {
+            auto it = map.find(key);
+            if(it == map.end()) return false;
+            out = it->second;
+        }
+        return true;
+    }
+};
+
+// run `writes` percent writes, rest reads on each thread, join all
+template<typename Write, typename Read> void run(unsigned threads, int writes, Write write, Read read) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for(unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            volatile int dummy = 0;
+            uint32_t     seed  = t * 2'654'435'761u + 1; // xorshift per thread
+            for(int i = 0; i < COUNT; ++i) {
+                seed ^= seed << 13;
+                seed ^= seed >> 17;
+                seed ^= seed << 5;
+                int key = int(seed % KEYS);
+                if(int(seed >> 16) % 100 < writes) {
+                    write(key, i);
+                }
+                else {
+                    int out = 0;
+                    if(read(key, out)) dummy = out;
+                }
+            }
+        });
+    }
+    for(auto& worker : workers) worker.join();
+}
+
+// million operations per second
+void throughput(const char* name, unsigned threads, float sec) {
+    double ops = double(threads) * COUNT;
+    printf("%s THROUGHPUT: %.2f Mops/s\n", name, sec > 0 ? ops / sec / 1'000'000 : 0.0);
+}
+
+int main() {
+    Bench::introduce();
+
+    unsigned max = std::thread::hardware_concurrency();
+    if(max == 0) max = 1;
+
+    std::cout << "OPERATION COUNT: " << COUNT << " PER THREAD\n"
+              << "KEY RANGE:       " << KEYS << "\n"
+              << "SEGMENTS:        " << lwe::config::SEGMENTS << "\n"
+              << "THREAD LIMIT:    " << max << "\n";
+    std::cout << std::endl;
+
+    // lock distribution: aligned keys must not pile into a few segments
+    {
+        static constexpr int SPREAD = 10'000;
+
+        std::vector<long*> heap(SPREAD);
+        for(long*& it : heap) it = new long(0);
+
+        lwe::container::ConcurrentHashTable<long*, int> pointers;
+        Concurrent                                      aligned;
+        for(int i = 0; i < SPREAD; ++i) {
+            pointers.insert(heap[i], i);
+            aligned.insert(i * 64, i);
+        }
+
+        Bench::line();
+        std::cout << "SEGMENTS USED BY " << SPREAD << " KEYS
+";
+        Bench::line(false);
+        std::cout << "HEAP POINTER: " << pointers.used() << " / " << lwe::config::SEGMENTS << "\n"
+                  << "I * 64:       " << aligned.used() << " / " << lwe::config::SEGMENTS << "\n";
+        Bench::line();
+        std::cout << std::endl;
+
+        for(long* it : heap) delete it;
+    }
+
+    struct Mix {
+        const char* name;
+        int         writes; // percent
+    };
+
+    for(Mix mix : { Mix{ "READ HEAVY (5% WRITE)", 5 }, Mix{ "WRITE HEAVY (50% WRITE)", 50 } }) {
+        std::cout << mix.name << "\n";
+
+        for(unsigned n = 1; n <= max; n <<= 1) {
+            Bench locked, concurrent;
+
+            for(int i = 0; i < Bench::TRY; ++i) {
+                Locked     map;
+                Concurrent table;
+
+                // prefill half of keys, same start state
+                for(int k = 0; k < KEYS; k += 2) {
+                    map.write(k, k);
+                    table.insert(k, k);
+                }
+
+                locked.once([&]() {
+                    run(n, mix.writes, [&](int k, int v) { map.write(k, v); }, [&](int k, int& v) { return map.read(k, v); });
+                });
+                concurrent.once([&]() {
+                    run(n, mix.writes, [&](int k, int v) { table.insert_or_assign(k, v); },
+                        [&](int k, int& v) { return table.find(k, v); });
+                });
+            }
+
+            locked.output("MUTEX MAP THREADS: ", n);
+            concurrent.output("CONCURRENT TABLE THREADS: ", n);
+
+            Bench::line(false);
+            throughput("MUTEX MAP ", n, locked.average());
+            throughput("CONCURRENT", n, concurrent.average());
+
+            std::cout << "CONCURRENT TABLE PERFORMANCE COMPARED TO MUTEX MAP\n";
+            concurrent.from(locked.average());
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include "internal/bench.hpp"
+
+#include "../../container/tree_table.hpp"
+#include "../../container/flat_table.hpp"
+#include "../../util/random.hpp"
+#include <map>
+#include <vector>
+
+static constexpr int COUNT = 1'000'000; // element count
+static constexpr int RANGE = 100;       // keys per range scan
+static constexpr int SCANS = 100'000;   // range scan count
+
+using Std  = std::map<int, int>;
+using Tree = lwe::container::TreeTable<int, int>;
+using Flat = lwe::container::FlatTable<int, int>;
+using Node = lwe::container::TreeBuffer<Tree::Entry, int>; // node capacity
+
+// million operations per second
+void throughput(const char* name, int count, float sec) {
+    printf("%s THROUGHPUT: %.2f Mops/s\n", name, sec > 0 ? count / sec / 1'000'000 : 0.0);
+}
+
+int main() {
+    Bench::introduce();
+
+    // shuffled unique keys, even: hit
+    std::vector<int> keys(COUNT);
+    for(int i = 0; i < COUNT; ++i) keys[i] = i << 1;
+    for(int i = COUNT - 1; i > 0; --i) std::swap(keys[i], keys[lwe::util::Random::generate(0, i)]);
+
+    // random lookups and range starts
+    std::vector<int> hit(COUNT), from(SCANS);
+    for(int i = 0; i < COUNT; ++i) hit[i] = keys[lwe::util::Random::generate(0, COUNT - 1)];
+    for(int i = 0; i < SCANS; ++i) from[i] = lwe::util::Random::generate(0, (COUNT - RANGE) << 1);
+
+    std::cout << "ELEMENT COUNT: " << COUNT << "\n"
+              << "TREE NODE:     " << lwe::config::TREENODE << " BYTES (LEAF " << Node::LEAF << ", INNER " << Node::INNER << ")\n"
+              << "RANGE SCAN:    " << SCANS << " x " << RANGE << " KEYS\n";
+    std::cout << std::endl;
+
+    Bench        bench;
+    float        stlsec;
+    volatile int var = 0;
+
+    // run std, tree, flat in order, compare to std
+    auto compare = [&](const char* name, int count, auto&& fnstd, auto&& fntree, auto&& fnflat) {
+        bench.loop(fnstd);
+        bench.output("STD MAP ", name);
+        stlsec = bench.average();
+        throughput("STD MAP ", count, stlsec);
+
+        bench.loop(fntree);
+        bench.output("TREE MAP ", name);
+        throughput("TREE MAP", count, bench.average());
+        bench.from(stlsec);
+
+        bench.loop(fnflat);
+        bench.output("FLAT MAP ", name);
+        throughput("FLAT MAP", count, bench.average());
+        bench.from(stlsec);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // INSERT (RANDOM ORDER), FLAT: BULK BUILD, ONE SORT
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "INSERT",
+        COUNT,
+        [&]() {
+            Std temp;
+            for(int i = 0; i < COUNT; ++i) temp.emplace(keys[i], i);
+            var = int(temp.size());
+        },
+        [&]() {
+            Tree temp;
+            for(int i = 0; i < COUNT; ++i) temp.push(keys[i], i);
+            var = int(temp.size());
+        },
+        [&]() {
+            std::vector<Flat::Entry> bulk;
+            bulk.reserve(COUNT);
+            for(int i = 0; i < COUNT; ++i) bulk.emplace_back(keys[i], i);
+            Flat temp;
+            temp.build(bulk.data(), bulk.size());
+            var = int(temp.size());
+        });
+
+    Std  stdmap;
+    Tree treemap;
+    Flat flatmap;
+    for(int i = 0; i < COUNT; ++i) stdmap.emplace(keys[i], i);
+    for(int i = 0; i < COUNT; ++i) treemap.push(keys[i], i);
+    for(auto& it : stdmap) flatmap.push(it.first, it.second); // sorted: append
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // FIND (RANDOM HIT)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "FIND",
+        COUNT,
+        [&]() { for(int i = 0; i < COUNT; ++i) var += stdmap.find(hit[i])->second; },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += treemap.find(hit[i])->second; },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += flatmap.find(hit[i])->second; });
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RANGE SCAN ([from, from + RANGE * 2), RANGE KEYS)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "RANGE SCAN",
+        SCANS,
+        [&]() {
+            for(int i = 0; i < SCANS; ++i) {
+                int to = from[i] + (RANGE << 1);
+                for(auto it = stdmap.lower_bound(from[i]); it != stdmap.end() && it->first < to; ++it) var += it->second;
+            }
+        },
+        [&]() {
+            for(int i = 0; i < SCANS; ++i) treemap.scan(from[i], from[i] + (RANGE << 1), [&](const Tree::Entry& it) { var += it.second; });
+        },
+        [&]() {
+            for(int i = 0; i < SCANS; ++i) flatmap.scan(from[i], from[i] + (RANGE << 1), [&](const Flat::Entry& it) { var += it.second; });
+        });
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ITERATE (ALL, IN ORDER)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "ITERATE",
+        COUNT,
+        [&]() { for(auto& it : stdmap) var += it.second; },
+        [&]() { for(auto& it : treemap) var += it.second; },
+        [&]() { for(auto& it : flatmap) var += it.second; });
+
+    std::cout << std::endl;
+}
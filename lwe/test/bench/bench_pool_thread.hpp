@@ -0,0 +1,139 @@
+#include "internal/bench.hpp"
+
+#include "../../mem/allocator.hpp"
+#include <vector>
+#include <thread>
+
+static constexpr int COUNT = 100'000; // per thread, per round
+static constexpr int ROUND = 10;      // alloc / free round
+
+struct Type {
+    Type()  = default;
+    ~Type() = default;
+
+    char array[128];
+};
+
+// run same work on each thread, join all
+template<typename Alloc, typename Free> void run(unsigned threads, Alloc alloc, Free dealloc) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for(unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            std::vector<void*> ptr(COUNT);
+            for(int r = 0; r < ROUND; ++r) {
+                for(int i = 0; i < COUNT; ++i) ptr[i] = alloc();
+                for(int i = 0; i < COUNT; ++i) dealloc(ptr[i]);
+            }
+        });
+    }
+    for(auto& worker : workers) worker.join();
+}
+
+// allocate on each thread, free on next thread
+template<typename Alloc, typename Free> void cross(unsigned threads, Alloc alloc, Free dealloc) {
+    std::vector<std::vector<void*>> ptr(threads, std::vector<void*>(COUNT));
+    for(int r = 0; r < ROUND; ++r) {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for(unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                for(int i = 0; i < COUNT; ++i) ptr[t][i] = alloc();
+            });
+        }
+        for(auto& worker : workers) worker.join();
+        workers.clear();
+        for(unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t]() {
+                auto& other = ptr[(t + 1) % threads]; // producer -> consumer
+                for(int i = 0; i < COUNT; ++i) dealloc(other[i]);
+            });
+        }
+        for(auto& worker : workers) worker.join();
+    }
+}
+
+// million operations per second, alloc + free
+void throughput(const char* name, unsigned threads, float sec) {
+    double ops = double(threads) * COUNT * ROUND * 2;
+    printf("%s THROUGHPUT: %.2f Mops/s\n", name, sec > 0 ? ops / sec / 1'000'000 : 0.0);
+}
+
+int main() {
+    Bench::introduce();
+
+    unsigned max = std::thread::hardware_concurrency();
+    if(max == 0) max = 1;
+
+    std::cout << "ELEMENT SIZE:  " << sizeof(Type) << "\n"
+              << "ELEMENT COUNT: " << COUNT << " x " << ROUND << " ROUND PER THREAD\n"
+              << "THREAD LIMIT:  " << max << "\n";
+    std::cout << std::endl;
+
+    // old path: lock per call
+    lwe::mem::Pool    pool{ sizeof(Type) };
+    lwe::async::Lock  lock;
+
+    // warm-up
+    run(max, []() -> void* { return new Type; }, [](void* in) { delete static_cast<Type*>(in); });
+    run(max, [&]() -> void* { LOCKGUARD(lock) return pool.allocate<void>(); return nullptr; },
+        [&](void* in) { LOCKGUARD(lock) pool.deallocate<void>(in); });
+    run(max, []() -> void* { return lwe::mem::Allocator<Type>::allocate(); },
+        [](void* in) { lwe::mem::Allocator<Type>::deallocate(static_cast<Type*>(in)); });
+
+    for(unsigned n = 1; n <= max; n <<= 1) {
+        Bench def, locked, cached;
+
+        for(int i = 0; i < Bench::TRY; ++i) {
+            def.once([&]() {
+                run(n, []() -> void* { return new Type; }, [](void* in) { delete static_cast<Type*>(in); });
+            });
+            locked.once([&]() {
+                run(n, [&]() -> void* { LOCKGUARD(lock) return pool.allocate<void>(); return nullptr; },
+                    [&](void* in) { LOCKGUARD(lock) pool.deallocate<void>(in); });
+            });
+            cached.once([&]() {
+                run(n, []() -> void* { return lwe::mem::Allocator<Type>::allocate(); },
+                    [](void* in) { lwe::mem::Allocator<Type>::deallocate(static_cast<Type*>(in)); });
+            });
+        }
+
+        def.output("NEW / DELETE THREADS: ", n);
+        locked.output("LOCKED POOL THREADS: ", n);
+        cached.output("MAGAZINE POOL THREADS: ", n);
+
+        Bench::line(false);
+        throughput("NEW / DELETE", n, def.average());
+        throughput("LOCKED POOL ", n, locked.average());
+        throughput("MAGAZINE    ", n, cached.average());
+
+        std::cout << "MAGAZINE PERFORMANCE COMPARED TO LOCKED POOL\n";
+        cached.from(locked.average());
+    }
+
+    // cross-thread free: locked deallocate vs remote free list
+    for(unsigned n = 1; n <= max; n <<= 1) {
+        Bench locked, remote;
+
+        for(int i = 0; i < Bench::TRY; ++i) {
+            locked.once([&]() {
+                cross(n, [&]() -> void* { LOCKGUARD(lock) return pool.allocate<void>(); return nullptr; },
+                      [&](void* in) { LOCKGUARD(lock) pool.deallocate<void>(in); });
+            });
+            remote.once([&]() {
+                cross(n, [&]() -> void* { LOCKGUARD(lock) return pool.allocate<void>(); return nullptr; },
+                      [&](void* in) { pool.defer<void>(in); });
+            });
+        }
+
+        locked.output("CROSS LOCKED FREE THREADS: ", n);
+        remote.output("CROSS REMOTE FREE THREADS: ", n);
+
+        Bench::line(false);
+        throughput("CROSS LOCKED", n, locked.average());
+        throughput("CROSS REMOTE", n, remote.average());
+
+        std::cout << "REMOTE FREE PERFORMANCE COMPARED TO LOCKED FREE\n";
+        remote.from(locked.average());
+    }
+}
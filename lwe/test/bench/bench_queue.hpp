@@ -0,0 +1,207 @@
+#include "internal/bench.hpp"
+
+#include "../../container/ring_buffer.hpp"
+#include "../../async/queue.hpp"
+#include <vector>
+#include <thread>
+
+static constexpr int    COUNT    = 1'000'000; // items per producer
+static constexpr size_t CAPACITY = 1'024;     // queue capacity
+static constexpr size_t BATCH    = 32;        // items per batch call
+static constexpr int    PINGS    = 100'000;   // round trips for latency
+
+using Spsc = lwe::async::SpscQueue<int>;
+using Mpmc = lwe::async::MpmcQueue<int>;
+
+// old path: deque + mutex, unbounded (async::Worker pattern, stl::Deque is this ring without reflection)
+struct Locked {
+    lwe::container::RingBuffer<int> deque;
+    std::mutex                      mtx;
+
+    bool push(int in) {
+        LOCKGUARD(mtx) deque.push(in);
+        return true;
+    }
+
+    bool pull(int& out) {
+        bool pulled = false;
+        LOCKGUARD(mtx) pulled = deque.pull(out);
+        return pulled;
+    }
+};
+
+// wait for the other side, one core must not starve
+inline void yield() {
+    std::this_thread::yield();
+}
+
+// producers push COUNT items each, consumers pull all, join all
+// push: void(), producer body, pull: size_t(), pulled count
+template<typename Push, typename Pull> void run(unsigned producers, unsigned consumers, Push push, Pull pull) {
+    std::vector<std::thread> workers;
+    std::atomic<int>         left = int(producers) * COUNT;
+
+    workers.reserve(producers + consumers);
+    for(unsigned p = 0; p < producers; ++p) {
+        workers.emplace_back([&]() { push(); });
+    }
+    for(unsigned c = 0; c < consumers; ++c) {
+        workers.emplace_back([&]() {
+            while(left.load(std::memory_order_relaxed) > 0) {
+                size_t n = pull();
+                if(n) left.fetch_sub(int(n), std::memory_order_relaxed);
+                else yield();
+            }
+        });
+    }
+    for(auto& worker : workers) worker.join();
+}
+
+// single item push of COUNT
+template<typename Q> void single(Q& queue) {
+    for(int i = 0; i < COUNT;) {
+        if(queue.push(i)) ++i;
+        else yield();
+    }
+}
+
+// batch push of COUNT
+template<typename Q> void batch(Q& queue) {
+    int items[BATCH];
+    for(int i = 0; i < COUNT;) {
+        size_t n = COUNT - i < int(BATCH) ? size_t(COUNT - i) : BATCH;
+        for(size_t k = 0; k < n; ++k) items[k] = i + int(k);
+        size_t pushed = queue.push(items, n);
+        if(pushed) i += int(pushed);
+        else yield();
+    }
+}
+
+// million items per second
+void throughput(const char* name, unsigned producers, float sec) {
+    double ops = double(producers) * COUNT;
+    printf("%s THROUGHPUT: %.2f Mops/s\n", name, sec > 0 ? ops / sec / 1'000'000 : 0.0);
+}
+
+// round trip over two queues, average nanoseconds
+template<typename Q> double latency(Q& ping, Q& pong) {
+    std::thread echo([&]() {
+        int value = 0;
+        for(int i = 0; i < PINGS; ++i) {
+            while(!ping.pull(value)) yield();
+            while(!pong.push(value)) yield();
+        }
+    });
+
+    auto begin = std::chrono::steady_clock::now();
+    int  value = 0;
+    for(int i = 0; i < PINGS; ++i) {
+        while(!ping.push(i)) yield();
+        while(!pong.pull(value)) yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+    echo.join();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / PINGS;
+}
+
+int main() {
+    Bench::introduce();
+
+    unsigned max = std::thread::hardware_concurrency();
+    if(max == 0) max = 1;
+    unsigned pairs = max < 4 ? 2 : max >> 1; // producers == consumers
+
+    std::cout << "ITEM COUNT:   " << COUNT << " PER PRODUCER\n"
+              << "CAPACITY:     " << CAPACITY << "\n"
+              << "BATCH:        " << BATCH << "\n"
+              << "THREAD LIMIT: " << max << "\n";
+    std::cout << std::endl;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // THROUGHPUT: 1 PRODUCER, 1 CONSUMER
+    ///////////////////////////////////////////////////////////////////////////////
+
+    {
+        Bench locked, spsc, spscbatch, mpmc;
+        for(int i = 0; i < Bench::TRY; ++i) {
+            Locked lq;
+            Spsc   sq(CAPACITY), bq(CAPACITY);
+            Mpmc   mq(CAPACITY);
+            int    out[BATCH];
+
+            locked.once([&]() { run(1, 1, [&]() { single(lq); }, [&]() { return size_t(lq.pull(out[0])); }); });
+            spsc.once([&]() { run(1, 1, [&]() { single(sq); }, [&]() { return size_t(sq.pull(out[0])); }); });
+            spscbatch.once([&]() { run(1, 1, [&]() { batch(bq); }, [&]() { return bq.pull(out, BATCH); }); });
+            mpmc.once([&]() { run(1, 1, [&]() { single(mq); }, [&]() { return size_t(mq.pull(out[0])); }); });
+        }
+
+        locked.output("MUTEX DEQUE 1 x 1");
+        spsc.output("SPSC QUEUE 1 x 1");
+        spsc.from(locked.average());
+        spscbatch.output("SPSC QUEUE BATCH 1 x 1");
+        spscbatch.from(locked.average());
+        mpmc.output("MPMC QUEUE 1 x 1");
+        mpmc.from(locked.average());
+
+        Bench::line(false);
+        throughput("MUTEX DEQUE", 1, locked.average());
+        throughput("SPSC       ", 1, spsc.average());
+        throughput("SPSC BATCH ", 1, spscbatch.average());
+        throughput("MPMC       ", 1, mpmc.average());
+        std::cout << std::endl;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // THROUGHPUT: N PRODUCERS, N CONSUMERS
+    ///////////////////////////////////////////////////////////////////////////////
+
+    {
+        Bench locked, mpmc, mpmcbatch;
+        for(int i = 0; i < Bench::TRY; ++i) {
+            Locked lq;
+            Mpmc   mq(CAPACITY), bq(CAPACITY);
+
+            locked.once([&]() {
+                run(pairs, pairs, [&]() { single(lq); }, [&]() { int out; return size_t(lq.pull(out)); });
+            });
+            mpmc.once([&]() {
+                run(pairs, pairs, [&]() { single(mq); }, [&]() { int out; return size_t(mq.pull(out)); });
+            });
+            mpmcbatch.once([&]() {
+                run(pairs, pairs, [&]() { batch(bq); }, [&]() { int out[BATCH]; return bq.pull(out, BATCH); });
+            });
+        }
+
+        locked.output("MUTEX DEQUE ", pairs, " x ", pairs);
+        mpmc.output("MPMC QUEUE ", pairs, " x ", pairs);
+        mpmc.from(locked.average());
+        mpmcbatch.output("MPMC QUEUE BATCH ", pairs, " x ", pairs);
+        mpmcbatch.from(locked.average());
+
+        Bench::line(false);
+        throughput("MUTEX DEQUE", pairs, locked.average());
+        throughput("MPMC       ", pairs, mpmc.average());
+        throughput("MPMC BATCH ", pairs, mpmcbatch.average());
+        std::cout << std::endl;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // LATENCY: PING PONG ROUND TRIP
+    ///////////////////////////////////////////////////////////////////////////////
+
+    {
+        Locked lping, lpong;
+        Spsc   sping(CAPACITY), spong(CAPACITY);
+        Mpmc   mping(CAPACITY), mpong(CAPACITY);
+
+        Bench::line();
+        printf("ROUND TRIP (%d PINGS)\n", PINGS);
+        Bench::line(false);
+        printf("MUTEX DEQUE: %.1f ns\n", latency(lping, lpong));
+        printf("SPSC QUEUE:  %.1f ns\n", latency(sping, spong));
+        printf("MPMC QUEUE:  %.1f ns\n", latency(mping, mpong));
+        Bench::line();
+    }
+
+    std::cout << std::endl;
+}
@@ -0,0 +1,61 @@
+#include "internal/bench.hpp"
+
+#include "../../container/hashed_buffer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static constexpr int    COUNT   = 4'000'000;   // insert count
+static constexpr size_t STEPS[] = { 0, 2, 8 }; // 0: rehash at once
+
+using Clock = std::chrono::steady_clock;
+
+// per insert latency (ns), util::Timer filters micro delays
+std::vector<uint64_t> measure(size_t step) {
+    lwe::container::HashedBuffer<int> set;
+    set.incremental(step);
+
+    std::vector<uint64_t> ns(COUNT);
+    for(int i = 0; i < COUNT; ++i) {
+        auto begin = Clock::now();
+        set.push(i);
+        ns[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count();
+    }
+    return ns;
+}
+
+void report(size_t step, std::vector<uint64_t>& ns) {
+    double total = 0;
+    for(uint64_t it : ns) total += double(it);
+
+    std::sort(ns.begin(), ns.end());
+    auto percentile = [&ns](double p) { return ns[size_t(double(ns.size() - 1) * p)]; };
+
+    Bench::line();
+    if(step == 0) {
+        std::cout << "REHASH AT ONCE\n";
+    }
+    else std::cout << "INCREMENTAL REHASH STEP: " << step << "\n";
+    Bench::line(false);
+    printf("AVG:   %10.1f NS\n", total / double(ns.size()));
+    printf("P50:   %10llu NS\n", (unsigned long long)percentile(0.50));
+    printf("P99:   %10llu NS\n", (unsigned long long)percentile(0.99));
+    printf("P99.9: %10llu NS\n", (unsigned long long)percentile(0.999));
+    printf("WORST: %10llu NS\n", (unsigned long long)ns.back());
+}
+
+int main() {
+    Bench::introduce();
+
+    std::cout << "INSERT COUNT: " << COUNT << "\n"
+              << "LOAD FACTOR:  " << lwe::config::LOADFACTOR << "\n";
+    std::cout << std::endl;
+
+    measure(0); // warm-up
+
+    for(size_t step : STEPS) {
+        std::vector<uint64_t> ns = measure(step);
+        report(step, ns);
+    }
+    Bench::line();
+}
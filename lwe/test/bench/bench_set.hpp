@@ -6,6 +6,7 @@
 #include "../../stl/set.hpp"
 #include "../../util/timer.hpp"
 #include "../../util/random.hpp"
+#include "../../mem/resource.hpp"
 
 using namespace lwe::mem;
 using namespace lwe::stl;
@@ -60,6 +61,7 @@ template<size_t N> struct std::hash<InvalidData<N>> {
  **************************************************************************************************/
 template<size_t, int> void test_insert();
 template<size_t, int> void test_collision();
+template<size_t, int> void test_backend();
 template<size_t, int> void test_main(); 
 
 int main() {
@@ -96,6 +98,10 @@ template<size_t N, int INSERT> void test_main() {
     std::cout << "HASH COLLISION TEST\n";                // summary
     b.line();                                            // line
     test_collision<N, INSERT>();                         // collision test
+    std::cout << "HASH BACKEND TEST (CHAINING / PROBING)\n"; // summary
+    b.line();                                            // line
+    test_backend<8, INSERT>();                           // small element
+    test_backend<N, INSERT>();                           // large element
     std::cout << std::endl;                              // endline
 }
 
@@ -141,6 +147,39 @@ template<size_t SIZE, int COUNT> void test_insert() {
     bench.output("LWE INSERT (INITIAL) COUNT: ", COUNT);
     bench.from(stlsec);
 
+    ///////////////////////////////////////////////////////////////////////////////
+    // INSERT (INITIAL, SAME ALLOCATOR: mem::Heap)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    bench.loop([&]() {
+        std::pmr::unordered_set<Type> temp(lwe::mem::HeapResource::instance());
+        for(int i = 0; i < COUNT; ++i) temp.insert(i);
+        volatile size_t size = temp.size(); // unoptimized
+    });
+    bench.output("PMR INSERT (HEAP) COUNT: ", COUNT);
+    stlsec = bench.average();
+
+    bench.loop([&]() {
+        LWE::stl::Set<Type, lwe::mem::Heap> temp(LOAD_FACTOR);
+        for(int i = 0; i < COUNT; ++i) temp.push(i);
+        volatile size_t size = temp.size(); // unoptimized
+    });
+    bench.output("LWE INSERT (HEAP) COUNT: ", COUNT);
+    bench.from(stlsec);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // INSERT (INITIAL, NODE POOL: mem::PoolResource)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    bench.loop([&]() {
+        lwe::mem::PoolResource        nodes(sizeof(Type) + 2 * sizeof(void*)); // node: next + hash
+        std::pmr::unordered_set<Type> temp(&nodes);
+        for(int i = 0; i < COUNT; ++i) temp.insert(i);
+        volatile size_t size = temp.size(); // unoptimized
+    });
+    bench.output("PMR INSERT (POOL) COUNT: ", COUNT);
+    bench.from(stlsec);
+
     ///////////////////////////////////////////////////////////////////////////////
     // WARM UP
     ///////////////////////////////////////////////////////////////////////////////
@@ -298,3 +337,137 @@ template<size_t SIZE, int COUNT> void test_collision() {
     
     std::cout << std::endl;
 }
+
+/**************************************************************************************************
+ * hash backend test code
+ **************************************************************************************************/
+template<size_t SIZE, int COUNT> void test_backend() {
+    using Type     = Data<SIZE>;
+    using Std      = std::unordered_set<Type>;
+    using Chaining = LWE::stl::Set<Type, LWE::mem::System, LWE::container::Chaining>;
+    using Probing  = LWE::stl::Set<Type, LWE::mem::System, LWE::container::Probing>;
+    using Ordered  = LWE::stl::Set<Type, LWE::mem::System, LWE::container::Ordered>;
+
+    std::cout << "ELEMENT SIZE: " << sizeof(Type) << "\n";
+    std::cout << "ELEMENT COUNT: " << COUNT << "\n";
+    std::cout << std::endl;
+
+    Std      stdset;
+    Chaining chainset(LOAD_FACTOR);
+    Probing  probeset(0.875f); // max
+    Ordered  orderset(0.875f); // max
+
+    Bench        bench;
+    float        stlsec;
+    volatile int var = 0;
+
+    // random keys, hit: [0, COUNT), miss: [COUNT, COUNT * 2)
+    std::vector<int> hit(COUNT), miss(COUNT);
+    for(int i = 0; i < COUNT; ++i) {
+        hit[i]  = lwe::util::Random::generate(0, COUNT - 1);
+        miss[i] = lwe::util::Random::generate(COUNT, COUNT * 2 - 1);
+    }
+
+    // run std, chaining, probing, ordered in order, compare to std
+    auto compare = [&](const char* name, auto&& fnstd, auto&& fnchain, auto&& fnprobe, auto&& fnorder) {
+        bench.loop(fnstd);
+        bench.output("STD ", name);
+        stlsec = bench.average();
+
+        bench.loop(fnchain);
+        bench.output("CHAINING ", name);
+        bench.from(stlsec);
+
+        bench.loop(fnprobe);
+        bench.output("PROBING ", name);
+        bench.from(stlsec);
+
+        bench.loop(fnorder);
+        bench.output("ORDERED ", name);
+        bench.from(stlsec);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // INSERT (INITIAL)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "INSERT",
+        [&]() {
+            Std temp;
+            for(int i = 0; i < COUNT; ++i) temp.insert(i);
+            var = int(temp.size());
+        },
+        [&]() {
+            Chaining temp(LOAD_FACTOR);
+            for(int i = 0; i < COUNT; ++i) temp.push(i);
+            var = int(temp.size());
+        },
+        [&]() {
+            Probing temp(0.875f);
+            for(int i = 0; i < COUNT; ++i) temp.push(i);
+            var = int(temp.size());
+        },
+        [&]() {
+            Ordered temp(0.875f);
+            for(int i = 0; i < COUNT; ++i) temp.push(i);
+            var = int(temp.size());
+        });
+
+    for(int i = 0; i < COUNT; ++i) stdset.insert(i);
+    for(int i = 0; i < COUNT; ++i) chainset.push(i);
+    for(int i = 0; i < COUNT; ++i) probeset.push(i);
+    for(int i = 0; i < COUNT; ++i) orderset.push(i);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // FIND HIT / MISS
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "FIND HIT",
+        [&]() { for(int i = 0; i < COUNT; ++i) var += stdset.find(hit[i])->n; },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += chainset.find(hit[i])->n; },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += probeset.find(hit[i])->n; },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += orderset.find(hit[i])->n; });
+
+    compare(
+        "FIND MISS",
+        [&]() { for(int i = 0; i < COUNT; ++i) var += stdset.find(miss[i]) == stdset.end(); },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += chainset.find(miss[i]) == chainset.end(); },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += probeset.find(miss[i]) == probeset.end(); },
+        [&]() { for(int i = 0; i < COUNT; ++i) var += orderset.find(miss[i]) == orderset.end(); });
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ITERATE
+    ///////////////////////////////////////////////////////////////////////////////
+
+    compare(
+        "ITERATE",
+        [&]() { for(auto& it : stdset) var += it.n; },
+        [&]() { for(auto& it : chainset) var += it.n; },
+        [&]() { for(auto& it : probeset) var += it.n; },
+        [&]() { for(auto& it : orderset) var += it.n; });
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ERASE (AND REFILL, NOT MEASURED)
+    ///////////////////////////////////////////////////////////////////////////////
+
+    // ordered is skipped, erase of a front item shifts all later items (O(n))
+    Bench std_erase, chain_erase, probe_erase;
+    for(int t = 0; t < Bench::TRY; ++t) {
+        std_erase.once([&]() { for(int i = 0; i < COUNT; ++i) stdset.erase(i); });
+        chain_erase.once([&]() { for(int i = 0; i < COUNT; ++i) chainset.pop(i); });
+        probe_erase.once([&]() { for(int i = 0; i < COUNT; ++i) probeset.pop(i); });
+
+        for(int i = 0; i < COUNT; ++i) stdset.insert(i);
+        for(int i = 0; i < COUNT; ++i) chainset.push(i);
+        for(int i = 0; i < COUNT; ++i) probeset.push(i);
+    }
+    std_erase.output("STD ERASE");
+    chain_erase.output("CHAINING ERASE");
+    chain_erase.from(std_erase.average());
+    probe_erase.output("PROBING ERASE");
+    probe_erase.from(std_erase.average());
+
+    std::cout << std::endl;
+}
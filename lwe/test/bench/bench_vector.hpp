@@ -3,6 +3,7 @@
 #include "vector"
 #include "C:\.workspace\git\low-level-workflow-essesntials\lwe\container\linear_buffer.hpp"
 #include "C:\.workspace\git\low-level-workflow-essesntials\lwe\test\bench\internal\bench.hpp"
+#include "../../mem/resource.hpp"
 
 #define RING_BUFFER
 
@@ -17,12 +18,32 @@ template<size_t N> struct Buffer {
     char buffer[N - sizeof(n)] = { 0 };
 };
 
+// non-trivial element, move takes the heap pointer, R: core::Relocatable
+template<size_t N, bool R> struct Owner {
+    Owner(int n = 0): n(n) { }
+    Owner(Owner&& in) noexcept: n(in.n), heap(in.heap) { in.heap = nullptr; }
+    Owner& operator=(Owner&& in) noexcept { return n = in.n, std::swap(heap, in.heap), *this; }
+    ~Owner() { delete[] heap; }
+
+    int   n;
+    char* heap = nullptr;
+    char  buffer[N - sizeof(n) - sizeof(heap)];
+};
+
+LWE_BEGIN
+namespace core {
+template<size_t N> struct Relocatable<Owner<N, true>>: std::true_type { };
+} // namespace core
+LWE_END
+
 static constexpr size_t SIZE  = 128;
 static constexpr size_t COUNT = lwe::core::align(0x7f'ff'ff'ff / SIZE) >> 1;
 
 using Std    = std::vector<Buffer<SIZE>>;
 using Lwe    = lwe::container::LinearBuffer<Buffer<SIZE>>;
 using LweSVO = lwe::container::LinearBuffer<Buffer<SIZE>, COUNT>;
+using Pmr    = std::pmr::vector<Buffer<SIZE>>;                                // mem::HeapResource
+using Heap   = lwe::container::LinearBuffer<Buffer<SIZE>, 0, lwe::mem::Heap>; // same allocator A/B
 
 // SVO: slower iteration for 128-byte elements, equivalent for 8-byte, cause unknown
 LweSVO lwesvo;
@@ -58,8 +79,60 @@ int main() {
     std_push.output("STD_PUSH (NO CACHE)");
     lwe_push.output("LWE_PUSH (NO CACHE)");
 
+    /***********************************************************************************************
+     * PUSH TEST (SAME ALLOCATOR: mem::Heap)
+     ***********************************************************************************************/
+
+    Bench pmr_push, heap_push;
+    for(int i = 0; i < Bench::TRY; ++i) {
+        Pmr  pmrvec(lwe::mem::HeapResource::instance());
+        Heap heapvec;
+
+        pmr_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) pmrvec.push_back(i); // push
+            dummy = pmrvec.size();                              // read
+        });
+        heap_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) heapvec.push_back(i); // push
+            dummy = heapvec.size();                               // read
+        });
+    }
+
+    pmr_push.output("PMR_PUSH (HEAP)");
+    heap_push.output("LWE_PUSH (HEAP)");
+
     std::cout << std::endl;
 
+    /***********************************************************************************************
+     * PUSH TEST (NON-TRIVIAL, GROWTH: MOVE AND DESTROY EACH / REALLOC)
+     ***********************************************************************************************/
+
+    Bench own_push, move_push, reloc_push;
+    for(int i = 0; i < Bench::TRY; ++i) {
+        std::vector<Owner<SIZE, true>>   ownvec;
+        LinearBuffer<Owner<SIZE, false>> movevec;
+        LinearBuffer<Owner<SIZE, true>>  relocvec;
+
+        own_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) ownvec.emplace_back(i); // push
+            dummy = ownvec.size();                                 // read
+        });
+        move_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) movevec.push(i); // push
+            dummy = movevec.size();                         // read
+        });
+        reloc_push.once([&]() {
+            for(int i = 0; i < COUNT; ++i) relocvec.push(i); // push
+            dummy = relocvec.size();                         // read
+        });
+    }
+
+    own_push.output("STD_PUSH (NON-TRIVIAL)");
+    move_push.output("LWE_PUSH (NON-TRIVIAL, MOVE)");
+    move_push.from(own_push.average());
+    reloc_push.output("LWE_PUSH (NON-TRIVIAL, RELOCATABLE)");
+    reloc_push.from(move_push.average()); // gain of relocation
+
     /***********************************************************************************************
      * PUSH POP PRE
      ***********************************************************************************************/
@@ -10,6 +10,10 @@
 #include "../stl/deque.hpp"       // included meta.h
 #include "../stl/set.hpp"         // included meta.h
 #include "../stl/map.hpp"         // included meta.h
+#include "../stl/tree_set.hpp"    // included meta.h
+#include "../stl/tree_map.hpp"    // included meta.h
+#include "../stl/flat_map.hpp"    // included meta.h
+#include "../mem/heap.hpp"        // allocator policy
 
 // REGISTER OTHER CONTAINER
 template<typename T> struct StdVectorAdapter : std::vector<T> {
@@ -37,6 +41,22 @@ void example_container() {
     Set<int>      lweset; // unordered_set
     Map<int, int> lwemap; // unordered_map
 
+    // ALLOCATOR POLICY (LAST TEMPLATE PARAMETER, DEFAULT: mem::System)
+    Stack<int, 0, lwe::mem::Heap> heapvec; // pooled memory, still serializable
+    Map<int, int, lwe::mem::Heap> heapmap; // pooled buckets and chains
+    heapvec.deserialize("[ 1, 2, 3 ]");
+    heapmap.push(0, 1);
+
+    // ORDERED CONTAINER (SORTED BY KEY, RANGE QUERY)
+    TreeSet<int>                      treeset;  // set, B+tree with pooled nodes
+    TreeMap<int, int>                 treemap;  // map, B+tree with pooled nodes
+    TreeMap<int, int, lwe::mem::Heap> heaptree; // map, nodes from allocator policy
+    FlatMap<int, int>                 flatmap;  // map, sorted array for read-mostly data
+    treemap.deserialize("[ { 3, 0 }, { 1, 0 } ]");
+    std::cout << treemap.serialize();           // [ { 1, 0 }, { 3, 0 } ]
+    treemap.scan(1, 3, [](const auto& it) { }); // keys in [1, 3)
+    flatmap.lower_bound(2);                     // first key not less than 2
+
     // DEFAULT CONTAINER (NOT SERIALIZABLE)
 
     container::LinearBuffer<int>   linearBuffer; // stack (vector)
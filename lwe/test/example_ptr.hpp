@@ -71,15 +71,15 @@ void example_ptr() {
             }
         }
 
-        Ptr<int> dangling = weak; // WARNING: DANGLING COPY
+        Ptr<int> dangling = weak; // DANGLING COPY
 
-        Ptr<int> owner2 = int{ 200 }; // address that are the same as the owner's block
+        Ptr<int> owner2 = int{ 200 }; // reuses the slot of the owner, next generation
 
-        // WARNING CASE
-        // get() is not throw exception
-        std::cout << *dangling.get() << "\n"; // 200
-        // Reason: use memory pool
-        // And, `owner` has been confirmed that it has been released normally.
+        // SAFE CASE
+        // get() is not throw exception, but returns nullptr
+        std::cout << (dangling.get() == nullptr) << "\n"; // 1
+        // Reason: generational slot map
+        // The handle generation is not the slot generation since the owner was released.
     }
 
     /* === EDGE CASE === */ {
@@ -123,6 +123,12 @@ void example_ptr() {
         std::cout << (a == aa.get()) << " " << (b == bb.get()) << "\n"; // 1 1, same address
         // THIS IS UNIQUE PTR, why not?
 
+        // handle size
+        std::cout << sizeof(Ptr<int>) << "\n"; // 8, slot index + generation
+
+        // iterate all live instances (dense array)
+        LWE::mem::Slotmap<A>::each([](A* in) { });
+
         // nullptr test
         Ptr<int> ptr = nullptr;
         // *ptr = 100; // WARNING: CRASH
@@ -2,12 +2,31 @@
 #define LWE_UTIL_ID
 
 #include "../base/base.h"
+#include "../config/config.h"
+
+/**************************************************************************************************
+ * ID<T>: unique non-zero id per T
+ *
+ *  shared counter: [ 1 ... 4096 ][ 4097 ... 8192 ][ 8193 ... ] << fetch_add(config::IDRANGE)
+ *                        |               |
+ *                     thread A        thread B   << thread-local range, no atomic in range
+ *
+ * - unique and non-zero, not ordered between threads.
+ * - unused ids of a range are discarded on thread exit.
+ * - config::IDRANGE == 1: fetch_add per id.
+ **************************************************************************************************/
 
 LWE_BEGIN
 namespace util {
 
 template<typename T> class ID {
-    static uint64_t next();
+    static uint64_t next(); //!< from thread-local range
+
+    //! @brief [curr, last)
+    struct Range {
+        uint64_t curr;
+        uint64_t last;
+    };
 
 public:
     //! @brief set id 0
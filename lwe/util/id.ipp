@@ -2,8 +2,17 @@ LWE_BEGIN
 namespace util {
 
 template<typename T> uint64_t ID<T>::next() {
-    static std::atomic<uint64_t> id = 1;
-    return id.fetch_add(1, std::memory_order_relaxed);
+    static std::atomic<uint64_t> id = 1; // 0: uninit
+    if constexpr(config::IDRANGE == 1) {
+        return id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    thread_local Range range = { 0, 0 };
+    if(range.curr == range.last) {
+        range.curr = id.fetch_add(config::IDRANGE, std::memory_order_relaxed); // reserve
+        range.last = range.curr + config::IDRANGE;
+    }
+    return range.curr++;
 }
 
 template<typename T> ID<T>::ID(Uninit): id(0) { }
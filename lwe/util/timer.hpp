@@ -3,6 +3,7 @@
 
 #include "../base/base.h"
 #include "../mem/block.hpp"
+#include "../mem/arena.hpp"
 
 LWE_BEGIN
 namespace util {
@@ -78,7 +79,7 @@ public:
     static void initialize(float = 60);
 
 public:
-    //! @brief update
+    //! @brief update, flip mem::Frame arena
     static void update();
 
 public:
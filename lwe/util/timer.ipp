@@ -93,6 +93,9 @@ void Tick::initialize(float fps) {
 }
 
 void Tick::update() {
+    // new frame scratch memory
+    mem::Frame::flip();
+
     // frame count
     ++frame.curr.n;
 